@@ -0,0 +1,581 @@
+//headless throughput benchmark
+//runs a cartridge for a fixed number of frames through libsnes with null
+//video/audio/input callbacks, and prints one JSON object per run to stdout.
+//
+//the emulation profile is selected at build time (make benchmark profile=...),
+//so each profile produces its own out/benchmark-<profile> binary.
+//
+//for determinism checks, --hash-record writes CRC32 hashes of the emulated state
+//after every frame (warmup included) to a text file, and --hash-verify compares a
+//run against such a file, reporting the first diverging frame and component.
+//--movie replays the input of a .bsv movie recorded by the Qt front-end.
+//
+//--bus runs a built-in program instead of a cartridge, to measure S-CPU bus
+//access throughput (CPU::op_read() / CPU::op_write()) in isolation. --dispatch
+//does the same for opcode dispatch (compare builds with and without cpucore=switch).
+
+#include <snes/libsnes/libsnes.hpp>
+#include <snes.hpp>
+
+#include <chrono>
+#include <nall/file.hpp>
+#include <nall/string.hpp>
+using namespace nall;
+
+//only the performance profile S-CPU (snes/alt/cpu) can fast-forward idle loops
+#if defined(PROFILE_PERFORMANCE)
+  #define BENCHMARK_IDLE_SKIP
+#endif
+
+static void video_refresh(const uint16_t*, unsigned, unsigned) {}
+static void audio_sample(uint16_t, uint16_t) {}
+static void input_poll() {}
+
+//deterministic replay state
+struct Replay {
+  file movie;
+  FILE *record;
+  FILE *verify;
+  bool full;
+  unsigned frame;
+
+  unsigned verified;        //frames compared against the verify file
+  bool diverged;
+  unsigned diverged_frame;
+  string diverged_components;
+
+  Replay() : record(0), verify(0), full(false), frame(0), verified(0), diverged(false), diverged_frame(0) {}
+} replay;
+
+static const char *const StateComponentNames[] = { "wram", "vram", "apuram", "cpu", "smp", "state" };
+
+//ports are polled in the same order as in the Qt front-end, so each call consumes one movie word
+static int16_t input_state(bool, unsigned, unsigned, unsigned) {
+  if(replay.movie.open() == false) return 0;
+  int16_t result = replay.movie.readl(2);
+  if(replay.movie.end()) replay.movie.close();
+  return result;
+}
+
+struct Options {
+  string filename;
+  unsigned frames;
+  unsigned warmup;
+  bool profile_scheduler;
+  unsigned sync_window;
+  bool idle_skip;
+  string movie;
+  string hash_record;
+  string hash_verify;
+  bool hash_full;
+  bool bus;
+  bool dispatch;
+  string rom_cache;
+
+  Options() : frames(600), warmup(60), profile_scheduler(false), sync_window(0), idle_skip(false), hash_full(false), bus(false), dispatch(false) {}
+};
+
+struct Result {
+  unsigned frames;
+  uint64_t cycles;
+  double seconds;
+  uint64_t idle_loops;
+  uint64_t idle_waits;
+  uint64_t idle_clocks;
+  uint64_t bus_accesses;
+  uint64_t opcodes;
+};
+
+static bool load(const string &filename) {
+  //headerless images are mapped rather than read, so processes running the same image share one copy
+  if(snes_load_cartridge_normal_file(0, filename)) return true;
+
+  file fp;
+  if(fp.open(filename, file::mode::read) == false) return false;
+
+  unsigned size = fp.size();
+  uint8_t *data = new uint8_t[size];
+  fp.read(data, size);
+  fp.close();
+
+  //strip copier header, if present
+  unsigned offset = (size & 0x7fff) == 512 ? 512 : 0;
+  bool result = snes_load_cartridge_normal(0, data + offset, size - offset);
+  delete[] data;
+  return result;
+}
+
+//bus micro-benchmark program (LoROM). its loop consists only of loads and stores
+//to SlowROM, FastROM, WRAM, I/O and XSlow addresses, so nearly all emulation time
+//is spent in CPU::op_read() and CPU::op_write(). each pass increments a 32-bit
+//counter in WRAM, from which the number of bus accesses follows exactly.
+static const uint8_t BusProgramInit[] = {
+  0x78,                          //sei
+  0x18, 0xfb,                    //clc; xce
+  0xa9, 0x01, 0x8d, 0x0d, 0x42,  //lda #$01; sta $420d (FastROM)
+  0xa9, 0x80, 0x8d, 0x00, 0x21,  //lda #$80; sta $2100 (forced blank)
+  0x5c, 0x00, 0x00, 0x80,        //jml $80:loop
+};
+
+static const uint8_t BusProgramBlock[] = {
+  0xaf, 0x00, 0x90, 0x00,  //lda $009000 (SlowROM)
+  0xaf, 0x00, 0x90, 0x80,  //lda $809000 (FastROM)
+  0x8f, 0x00, 0x01, 0x7e,  //sta $7e0100 (WRAM)
+  0xa5, 0x10,              //lda $10
+  0x85, 0x11,              //sta $11
+  0xad, 0x14, 0x42,        //lda $4214 (I/O)
+  0xad, 0x00, 0x41,        //lda $4100 (XSlow, open bus)
+};
+
+static const uint8_t BusProgramCounter[] = {
+  0xc2, 0x20,        //rep #$20
+  0xee, 0x00, 0x00,  //inc $0000
+  0xd0, 0x03,        //bne +3
+  0xee, 0x02, 0x00,  //inc $0002
+  0xe2, 0x20,        //sep #$20
+  0x80, 0x00,        //bra loop
+  0x40,              //rti (all interrupt vectors)
+};
+
+enum : unsigned {
+  BusProgramBlocks = 4,
+  BusAccessesPerBlock = 29,
+  BusAccessesPerPass = BusProgramBlocks * BusAccessesPerBlock + 15,
+  BusAccessesPerCarry = 7,  //inc $0002
+};
+
+//opcode dispatch micro-benchmark block: only implied and immediate opcodes, in all
+//four M/X modes, so that nearly all emulation time is spent fetching and dispatching
+//opcodes rather than in bus accesses. the loop is too long for bra, so its counter
+//branches back with brl instead.
+static const uint8_t DispatchProgramBlock[] = {
+  0xc2, 0x30,                          //rep #$30
+  0xe8, 0xc8, 0xca, 0x88,              //inx; iny; dex; dey
+  0x8a, 0xa8, 0xbb, 0x9b,              //txa; tay; tyx; txy
+  0x69, 0x34, 0x12,                    //adc #$1234
+  0x49, 0x55, 0x55,                    //eor #$5555
+  0x0a, 0x6a, 0x1a, 0x3a,              //asl; ror; inc; dec
+  0xe2, 0x20,                          //sep #$20
+  0x69, 0x12, 0x29, 0x7f,              //adc #$12; and #$7f
+  0x09, 0x01, 0xc9, 0x40,              //ora #$01; cmp #$40
+  0xeb, 0x0a, 0x4a,                    //xba; asl; lsr
+  0xe2, 0x10,                          //sep #$10
+  0xe8, 0xc8, 0xaa, 0xa8, 0x8a, 0x98,  //inx; iny; tax; tay; txa; tya
+  0xe0, 0x10, 0xc0, 0x20,              //cpx #$10; cpy #$20
+  0xc2, 0x20,                          //rep #$20
+  0x69, 0x34, 0x12,                    //adc #$1234
+  0xe9, 0x11, 0x11,                    //sbc #$1111
+  0x18, 0x38, 0xb8,                    //clc; sec; clv
+  0xe2, 0x30,                          //sep #$30
+  0xea,                                //nop
+};
+
+static const uint8_t DispatchProgramCounter[] = {
+  0xc2, 0x20,        //rep #$20
+  0xee, 0x00, 0x00,  //inc $0000
+  0xd0, 0x03,        //bne +3
+  0xee, 0x02, 0x00,  //inc $0002
+  0xe2, 0x20,        //sep #$20
+  0x82, 0x00, 0x00,  //brl loop
+  0x40,              //rti (all interrupt vectors)
+};
+
+enum : unsigned {
+  DispatchProgramBlocks = 16,
+  DispatchOpcodesPerBlock = 40,
+  DispatchOpcodesPerPass = DispatchProgramBlocks * DispatchOpcodesPerBlock + 5,
+  DispatchOpcodesPerCarry = 1,  //inc $0002
+};
+
+//assembles init, blocks and counter; the counter ends with bra or brl to the loop, then rti
+static bool load_program(const char *title, const uint8_t *block, unsigned size, unsigned blocks, const uint8_t *counter, unsigned counter_size) {
+  static uint8_t rom[0x8000];
+  memset(rom, 0, sizeof rom);
+  unsigned offset = 0;
+  memcpy(rom + offset, BusProgramInit, sizeof BusProgramInit);
+  offset += sizeof BusProgramInit;
+  unsigned loop = 0x8000 + offset;
+  rom[offset - 3] = loop;
+  rom[offset - 2] = loop >> 8;
+  for(unsigned n = 0; n < blocks; n++) {
+    memcpy(rom + offset, block, size);
+    offset += size;
+  }
+  memcpy(rom + offset, counter, counter_size);
+  offset += counter_size;
+  if(rom[offset - 4] == 0x82) {
+    unsigned displacement = loop - (0x8000 + offset - 1);
+    rom[offset - 3] = displacement;
+    rom[offset - 2] = displacement >> 8;
+  } else {
+    rom[offset - 2] = loop - (0x8000 + offset - 1);
+  }
+  unsigned rti = 0x8000 + offset - 1;
+
+  memset(rom + 0x7fc0, ' ', 21);
+  memcpy(rom + 0x7fc0, title, strlen(title));
+  rom[0x7fd5] = 0x20;  //LoROM
+  rom[0x7fd7] = 0x05;  //32KB
+  for(unsigned vector = 0x7fe4; vector < 0x7ffc; vector += 2) {
+    rom[vector + 0] = rti;
+    rom[vector + 1] = rti >> 8;
+  }
+  rom[0x7ffc] = 0x00;  //reset
+  rom[0x7ffd] = 0x80;
+
+  unsigned checksum = 0;
+  for(unsigned n = 0; n < sizeof rom; n++) checksum += rom[n];
+  checksum += 0x01fe;  //complement and checksum bytes sum to $01fe
+  rom[0x7fdc] = ~checksum;
+  rom[0x7fdd] = ~checksum >> 8;
+  rom[0x7fde] = checksum;
+  rom[0x7fdf] = checksum >> 8;
+
+  return snes_load_cartridge_normal(0, rom, sizeof rom);
+}
+
+static bool load_bus_program() {
+  return load_program("BUS BENCHMARK", BusProgramBlock, sizeof BusProgramBlock, BusProgramBlocks, BusProgramCounter, sizeof BusProgramCounter);
+}
+
+static bool load_dispatch_program() {
+  return load_program("DISPATCH BENCHMARK", DispatchProgramBlock, sizeof DispatchProgramBlock, DispatchProgramBlocks, DispatchProgramCounter, sizeof DispatchProgramCounter);
+}
+
+static uint32_t program_passes() {
+  return SNES::memory::wram[0] << 0 | SNES::memory::wram[1] << 8 | SNES::memory::wram[2] << 16 | SNES::memory::wram[3] << 24;
+}
+
+//the high word counts carries out of the low word, which take one more instruction
+static uint64_t program_count(uint32_t before, uint32_t after, unsigned per_pass, unsigned per_carry) {
+  uint64_t passes = (uint32_t)(after - before);
+  uint64_t carries = (uint32_t)((after >> 16) - (before >> 16));
+  return passes * per_pass + carries * per_carry;
+}
+
+//loads the power-on or savestate snapshot a .bsv movie starts from; input follows it
+static bool load_movie(const string &filename) {
+  if(replay.movie.open(filename, file::mode::read) == false) return false;
+  if(replay.movie.size() < 32) return false;
+  if(replay.movie.readm(4) != 0x42535631) return false;
+  if(replay.movie.readl(4) != SNES::Info::SerializerVersion) return false;
+  if(replay.movie.readl(4) != SNES::cartridge.crc32()) return false;
+
+  unsigned size = replay.movie.readl(4);
+  uint8_t *data = new uint8_t[size];
+  replay.movie.read(data, size);
+  serializer state(data, size);
+  delete[] data;
+  if(replay.movie.end()) replay.movie.close();
+  return SNES::system.unserialize(state);
+}
+
+static bool open_hashes(const Options &options) {
+  if(options.hash_record != "") {
+    replay.record = fopen(options.hash_record, "w");
+    if(!replay.record) return false;
+    fprintf(replay.record, "# bsnes state hashes: profile=%s", SNES::Info::Profile);
+    for(unsigned n = 0; n < SNES::System::StateComponents; n++) {
+      fprintf(replay.record, "%s%s", n ? "," : " components=", StateComponentNames[n]);
+    }
+    fprintf(replay.record, "\n");
+  }
+  if(options.hash_verify != "") {
+    replay.verify = fopen(options.hash_verify, "r");
+    if(!replay.verify) return false;
+  }
+  replay.full = options.hash_full;
+  return true;
+}
+
+static void close_hashes() {
+  if(replay.record) fclose(replay.record);
+  if(replay.verify) fclose(replay.verify);
+  replay.record = 0;
+  replay.verify = 0;
+}
+
+//reads the next recorded frame from the verify file, skipping comments
+static bool read_hashes(unsigned &frame, uint32_t hash[SNES::System::StateComponents]) {
+  char line[256];
+  while(fgets(line, sizeof line, replay.verify)) {
+    if(line[0] == '#') continue;
+    unsigned h[SNES::System::StateComponents];
+    if(sscanf(line, "%u %x %x %x %x %x %x", &frame, &h[0], &h[1], &h[2], &h[3], &h[4], &h[5]) != 7) return false;
+    for(unsigned n = 0; n < SNES::System::StateComponents; n++) hash[n] = h[n];
+    return true;
+  }
+  return false;
+}
+
+//called after every frame while recording or verifying
+static void hash_frame() {
+  uint32_t hash[SNES::System::StateComponents];
+  SNES::system.state_hash(hash, replay.full);
+  unsigned frame = replay.frame++;
+
+  if(replay.record) {
+    fprintf(replay.record, "%u", frame);
+    for(unsigned n = 0; n < SNES::System::StateComponents; n++) fprintf(replay.record, " %.8x", (unsigned)hash[n]);
+    fprintf(replay.record, "\n");
+  }
+
+  if(replay.verify == 0 || replay.diverged) return;
+  unsigned recorded_frame;
+  uint32_t recorded[SNES::System::StateComponents];
+  if(read_hashes(recorded_frame, recorded) == false || recorded_frame != frame) {
+    fclose(replay.verify);
+    replay.verify = 0;
+    return;
+  }
+
+  replay.verified++;
+  for(unsigned n = 0; n < SNES::System::StateComponents; n++) {
+    //a zero full-state hash means it was not computed on one side
+    if(n == (unsigned)SNES::System::StateComponent::All && (!hash[n] || !recorded[n])) continue;
+    if(hash[n] == recorded[n]) continue;
+    if(replay.diverged) replay.diverged_components.append(",");
+    replay.diverged_components.append(StateComponentNames[n]);
+    replay.diverged = true;
+  }
+  if(replay.diverged) replay.diverged_frame = frame;
+}
+
+static Result run(unsigned frames) {
+  Result result;
+  result.frames = frames;
+  result.cycles = 0;
+  result.idle_loops = 0;
+  result.idle_waits = 0;
+  result.idle_clocks = 0;
+  result.bus_accesses = 0;
+  result.opcodes = 0;
+
+  #if defined(BENCHMARK_IDLE_SKIP)
+  SNES::CPU::IdleStatistics idle = SNES::cpu.idle_statistics;
+  #endif
+  uint32_t clocks = SNES::cpu.clocks();
+  auto start = std::chrono::steady_clock::now();
+  for(unsigned n = 0; n < frames; n++) {
+    snes_run();
+    if(replay.record || replay.verify) hash_frame();
+    result.cycles += (uint32_t)(SNES::cpu.clocks() - clocks);
+    clocks = SNES::cpu.clocks();
+  }
+  auto finish = std::chrono::steady_clock::now();
+
+  result.seconds = std::chrono::duration<double>(finish - start).count();
+  #if defined(BENCHMARK_IDLE_SKIP)
+  result.idle_loops = SNES::cpu.idle_statistics.loops - idle.loops;
+  result.idle_waits = SNES::cpu.idle_statistics.waits - idle.waits;
+  result.idle_clocks = SNES::cpu.idle_statistics.clocks - idle.clocks;
+  #endif
+  return result;
+}
+
+static string escape(const char *s) {
+  string output;
+  for(; *s; s++) {
+    if(*s == '"' || *s == '\\') output.append("\\");
+    char c[2] = { *s, 0 };
+    output.append(c);
+  }
+  return output;
+}
+
+//context switches per frame and host time per thread, from SNES::scheduler instrumentation
+static void report_scheduler() {
+  typedef SNES::Scheduler::Thread Thread;
+  const SNES::Scheduler::Statistics &stats = SNES::scheduler.statistics;
+  double frames = stats.frames ? stats.frames : 1;
+
+  static const char *names[] = { "host", "cpu", "smp", "dsp", "ppu", "coprocessor" };
+  printf(",\"scheduler\":{\"switches_per_frame\":%.1f", stats.switch_count() / frames);
+  for(unsigned s = 0; s < SNES::Scheduler::ThreadCount; s++) {
+    for(unsigned d = 0; d < SNES::Scheduler::ThreadCount; d++) {
+      uint64_t count = stats.switch_count((Thread)s, (Thread)d);
+      if(count) printf(",\"%s_%s_per_frame\":%.1f", names[s], names[d], count / frames);
+    }
+  }
+  for(unsigned s = 0; s < SNES::Scheduler::ThreadCount; s++) {
+    printf(",\"%s_seconds\":%.6f", names[s], stats.time[s] / 1e9);
+  }
+  printf("}");
+}
+
+#if defined(SCHEDULER_QUEUE)
+static const char SchedulerBackend[] = "queue";
+#else
+static const char SchedulerBackend[] = "cothread";
+#endif
+
+#if defined(CPUCORE_SWITCH)
+static const char CPUDispatch[] = "switch";
+#else
+static const char CPUDispatch[] = "table";
+#endif
+
+//the accuracy profile's S-DSP runs on its own thread unless built with dsp=batched;
+//the other profiles' S-DSP (snes/alt/dsp) always steps along with the S-SMP
+static const char *const DSPMode = SNES::DSP::Batched ? "batched" : SNES::DSP::Threaded ? "threaded" : "synchronous";
+
+static void report(const Options &options, const Result &result) {
+  double seconds = result.seconds > 0 ? result.seconds : 1e-9;
+  printf(
+    "{\"profile\":\"%s\",\"scheduler_backend\":\"%s\",\"cpu_dispatch\":\"%s\",\"dsp\":\"%s\",\"version\":\"%s\",\"rom\":\"%s\","
+    "\"sync_window\":%u,\"frames\":%u,\"wall_seconds\":%.6f,\"frames_per_second\":%.3f,"
+    "\"emulated_cycles\":%llu,\"cycles_per_second\":%.0f",
+    SNES::Info::Profile, SchedulerBackend, CPUDispatch, DSPMode, SNES::Info::Version, (const char*)escape(options.filename),
+    options.sync_window, result.frames, result.seconds, result.frames / seconds,
+    (unsigned long long)result.cycles, result.cycles / seconds
+  );
+  if(options.profile_scheduler) report_scheduler();
+  if(options.idle_skip) {
+    printf(
+      ",\"idle\":{\"loops\":%llu,\"waits\":%llu,\"skipped_cycles\":%llu,\"skipped_fraction\":%.4f}",
+      (unsigned long long)result.idle_loops, (unsigned long long)result.idle_waits,
+      (unsigned long long)result.idle_clocks, result.cycles ? (double)result.idle_clocks / result.cycles : 0.0
+    );
+  }
+  if(options.hash_verify != "") {
+    printf(",\"verify\":{\"frames\":%u,\"diverged\":%s", replay.verified, replay.diverged ? "true" : "false");
+    if(replay.diverged) {
+      printf(",\"frame\":%u,\"components\":\"%s\"", replay.diverged_frame, (const char*)replay.diverged_components);
+    }
+    printf("}");
+  }
+  if(options.bus) {
+    printf(
+      ",\"bus\":{\"accesses\":%llu,\"accesses_per_second\":%.0f,\"clocks_per_access\":%.3f}",
+      (unsigned long long)result.bus_accesses, result.bus_accesses / seconds,
+      result.bus_accesses ? (double)result.cycles / result.bus_accesses : 0.0
+    );
+  }
+  if(options.dispatch) {
+    printf(
+      ",\"dispatch\":{\"opcodes\":%llu,\"opcodes_per_second\":%.0f,\"clocks_per_opcode\":%.3f}",
+      (unsigned long long)result.opcodes, result.opcodes / seconds,
+      result.opcodes ? (double)result.cycles / result.opcodes : 0.0
+    );
+  }
+  printf("}\n");
+  fflush(stdout);
+}
+
+static void usage() {
+  fprintf(stderr,
+    "usage: benchmark [options] <cartridge.sfc>\n"
+    "       benchmark [options] --bus | --dispatch\n"
+    "  --frames N  number of measured frames (default: 600)\n"
+    "  --warmup N  number of unmeasured frames run first (default: 60)\n"
+    "  --profile-scheduler  report context switches and host time per thread\n"
+    "  --sync-window N  S-CPU/S-SMP run-ahead window in samples (default: 0, lockstep)\n"
+    "  --idle-skip  fast-forward S-CPU idle loops and WAI (performance profile only)\n"
+    "  --movie FILE  replay the input of a .bsv movie\n"
+    "  --hash-record FILE  write per-frame state hashes to FILE\n"
+    "  --hash-verify FILE  compare per-frame state hashes against FILE\n"
+    "  --hash-full  also hash the complete serialized state each frame (much slower)\n"
+    "  --rom-cache DIR  share ROM images that cannot be mapped directly through DIR\n"
+    "  --bus  run the built-in S-CPU bus access micro-benchmark instead of a cartridge\n"
+    "  --dispatch  run the built-in 65816 opcode dispatch micro-benchmark instead of a cartridge\n"
+  );
+}
+
+int main(int argc, char **argv) {
+  Options options;
+
+  for(int n = 1; n < argc; n++) {
+    string arg = argv[n];
+    if(arg == "--frames" && n + 1 < argc) {
+      options.frames = decimal(argv[++n]);
+    } else if(arg == "--warmup" && n + 1 < argc) {
+      options.warmup = decimal(argv[++n]);
+    } else if(arg == "--profile-scheduler") {
+      options.profile_scheduler = true;
+    } else if(arg == "--sync-window" && n + 1 < argc) {
+      options.sync_window = decimal(argv[++n]);
+    } else if(arg == "--idle-skip") {
+      options.idle_skip = true;
+    } else if(arg == "--movie" && n + 1 < argc) {
+      options.movie = argv[++n];
+    } else if(arg == "--hash-record" && n + 1 < argc) {
+      options.hash_record = argv[++n];
+    } else if(arg == "--hash-verify" && n + 1 < argc) {
+      options.hash_verify = argv[++n];
+    } else if(arg == "--hash-full") {
+      options.hash_full = true;
+    } else if(arg == "--rom-cache" && n + 1 < argc) {
+      options.rom_cache = argv[++n];
+    } else if(arg == "--bus") {
+      options.bus = true;
+    } else if(arg == "--dispatch") {
+      options.dispatch = true;
+    } else if(strbegin(arg, "--")) {
+      usage();
+      return 1;
+    } else {
+      options.filename = arg;
+    }
+  }
+
+  if(options.bus || options.dispatch) {
+    if(options.bus == options.dispatch || options.filename != "") {
+      fprintf(stderr, "benchmark: --bus and --dispatch take no cartridge, and exclude each other\n");
+      return 1;
+    }
+    options.filename = options.bus ? "bus" : "dispatch";
+  }
+
+  if(options.filename == "") {
+    usage();
+    return 1;
+  }
+
+  snes_set_video_refresh(video_refresh);
+  snes_set_audio_sample(audio_sample);
+  snes_set_input_poll(input_poll);
+  snes_set_input_state(input_state);
+  snes_init();
+  SNES::config().smp.sync_window = options.sync_window;
+  SNES::config().cpu.idle_skip = options.idle_skip;
+  SNES::config().path.romcache = options.rom_cache;
+  //power-on state is otherwise randomized from the wall clock
+  if(options.hash_record != "" || options.hash_verify != "") SNES::config().random = false;
+
+  bool loaded = options.bus ? load_bus_program() : options.dispatch ? load_dispatch_program() : load(options.filename);
+  if(loaded == false) {
+    fprintf(stderr, "benchmark: unable to load %s\n", (const char*)options.filename);
+    return 1;
+  }
+
+  if(options.movie != "" && load_movie(options.movie) == false) {
+    fprintf(stderr, "benchmark: invalid movie %s\n", (const char*)options.movie);
+    return 1;
+  }
+
+  //the seed is part of the state even with randomization disabled
+  if(options.hash_record != "" || options.hash_verify != "") SNES::random.seed(0);
+
+  if(open_hashes(options) == false) {
+    fprintf(stderr, "benchmark: unable to open state hash file\n");
+    close_hashes();
+    return 1;
+  }
+
+  run(options.warmup);
+  if(options.profile_scheduler) SNES::scheduler.profile(true);
+  uint32_t passes = program_passes();
+  Result result = run(options.frames);
+  if(options.bus) result.bus_accesses = program_count(passes, program_passes(), BusAccessesPerPass, BusAccessesPerCarry);
+  if(options.dispatch) result.opcodes = program_count(passes, program_passes(), DispatchOpcodesPerPass, DispatchOpcodesPerCarry);
+  report(options, result);
+  close_hashes();
+
+  if(replay.diverged) {
+    fprintf(stderr, "benchmark: state diverges at frame %u (%s)\n", replay.diverged_frame, (const char*)replay.diverged_components);
+  }
+
+  snes_unload_cartridge();
+  snes_term();
+  return replay.diverged ? 2 : 0;
+}
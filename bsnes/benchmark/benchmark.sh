@@ -0,0 +1,21 @@
+#!/bin/sh
+# runs every built benchmark profile (see "make benchmark-all") against one cartridge;
+# output is one JSON object per line, suitable for appending to a regression log.
+#   usage: benchmark/benchmark.sh <cartridge.sfc> [benchmark options]
+
+if [ -z "$1" ]; then
+  echo "usage: $0 <cartridge.sfc> [--frames N] [--warmup N]" >&2
+  exit 1
+fi
+
+rom="$1"
+shift
+
+for profile in accuracy compatibility performance; do
+  binary="out/benchmark-$profile"
+  if [ -x "$binary" ]; then
+    "$binary" "$@" "$rom" || exit 1
+  else
+    echo "$0: $binary not found, skipping (build with: make benchmark profile=$profile)" >&2
+  fi
+done
@@ -4,14 +4,16 @@
 */
 
 #if defined(__clang__) || defined(__GNUC__)
+  /* the inline assembly variants address co_active_handle directly, */
+  /* which is not valid for thread-local storage (LIBCO_MP) */
   #if defined(__i386__)
-    #if defined(LIBCO_NO_INLINE_ASM)
+    #if defined(LIBCO_NO_INLINE_ASM) || defined(LIBCO_MP)
       #include "x86.c"
     #else
       #include "x86_gcc.c"
     #endif
   #elif defined(__amd64__)
-    #if defined(LIBCO_NO_INLINE_ASM)
+    #if defined(LIBCO_NO_INLINE_ASM) || defined(LIBCO_MP)
       #include "amd64.c"
     #else
       #include "amd64_gcc.c"
@@ -0,0 +1,84 @@
+/*
+  libco LIBCO_MP stress test (make libco-test libco_mp=1)
+
+  Several host threads run at once, each ping-ponging a ring of its own
+  cothreads. Every cothread checks on every switch that co_active() names
+  itself, and each host thread's primary context must be its own.
+*/
+
+#include <pthread.h>
+#include <stdio.h>
+#include "../libco.h"
+
+#if !defined(LIBCO_MP)
+  #error "the libco test needs per-thread cothreads: build with libco_mp=1"
+#endif
+
+enum { Threads = 8, Cothreads = 4, Switches = 2000000 };
+
+struct Thread {
+  cothread_t host;
+  cothread_t cothread[Cothreads];
+  unsigned long switches;
+  unsigned long errors;
+};
+
+static __thread struct Thread *self;
+
+static void entry(void) {
+  unsigned n = 0;
+  while(n < Cothreads && self->cothread[n] != co_active()) n++;
+  if(n == Cothreads) { self->errors++; co_switch(self->host); }
+
+  while(1) {
+    if(co_active() != self->cothread[n]) self->errors++;
+    if(++self->switches >= Switches) co_switch(self->host);
+    else co_switch(self->cothread[(n + 1) % Cothreads]);
+  }
+}
+
+static void* run(void *data) {
+  struct Thread *thread = (struct Thread*)data;
+  unsigned n;
+
+  self = thread;
+  thread->host = co_active();
+  for(n = 0; n < Cothreads; n++) thread->cothread[n] = co_create(64 * 1024, entry);
+
+  co_switch(thread->cothread[0]);
+  if(co_active() != thread->host || self != thread) thread->errors++;
+
+  for(n = 0; n < Cothreads; n++) co_delete(thread->cothread[n]);
+  return 0;
+}
+
+int main() {
+  static struct Thread thread[Threads];
+  pthread_t handle[Threads];
+  unsigned long errors = 0;
+  unsigned n, m;
+
+  for(n = 0; n < Threads; n++) {
+    if(pthread_create(&handle[n], 0, run, &thread[n])) {
+      fprintf(stderr, "libco test: failed to create host thread %u\n", n);
+      return 1;
+    }
+  }
+  for(n = 0; n < Threads; n++) pthread_join(handle[n], 0);
+
+  for(n = 0; n < Threads; n++) {
+    if(thread[n].errors) fprintf(stderr, "libco test: thread %u: %lu inconsistent co_active() results\n", n, thread[n].errors);
+    if(thread[n].switches != Switches) fprintf(stderr, "libco test: thread %u: %lu of %u switches\n", n, thread[n].switches, (unsigned)Switches);
+    errors += thread[n].errors + (thread[n].switches != Switches);
+    for(m = 0; m < n; m++) {
+      if(thread[m].host == thread[n].host) {
+        fprintf(stderr, "libco test: threads %u and %u share a primary context\n", m, n);
+        errors++;
+      }
+    }
+  }
+
+  printf("libco test: %u host threads x %u cothreads x %u switches: %s\n",
+    (unsigned)Threads, (unsigned)Cothreads, (unsigned)Switches, errors ? "FAILED" : "ok");
+  return errors ? 1 : 0;
+}
@@ -21,14 +21,19 @@ namespace SNES {
 #include "memory.cpp"
 #include "mmio.cpp"
 #include "timing.cpp"
+#include "idle.cpp"
 
 void CPU::step(unsigned clocks) {
   smp.clock -= clocks * (uint64)smp.frequency;
   ppu.clock -= clocks;
+  #if defined(SCHEDULER_QUEUE)
+  scheduler.coprocessor_queue.step(clocks);
+  #else
   for(unsigned i = 0; i < coprocessors.size(); i++) {
     Processor &chip = *coprocessors[i];
     chip.clock -= clocks * (uint64)chip.frequency;
   }
+  #endif
 }
 
 void CPU::synchronize_smp() {
@@ -48,10 +53,13 @@ void CPU::synchronize_ppu() {
 }
 
 void CPU::synchronize_coprocessor() {
+  #if defined(SCHEDULER_QUEUE)
+  scheduler.coprocessor_queue.synchronize();
+  #else
   for(unsigned i = 0; i < coprocessors.size(); i++) {
-    Processor &chip = *coprocessors[i];
-    if(chip.clock < 0) scheduler.resume(chip.thread);
+    coprocessors[i]->synchronize();
   }
+  #endif
 }
 
 void CPU::Enter() { cpu.enter(); }
@@ -80,12 +88,14 @@ void CPU::enter() {
       op_irq(regs.e == false ? 0xffee : 0xfffe);
     }
 
+    if(idle_skip) idle_loop();
     op_step();
   }
 }
 
 alwaysinline void CPU::op_step() {
-  (this->*opcode_table[op_readpc()])();
+  op_exec(op_readpc());
+  if(smp.lockstep) synchronize_smp();
 }
 
 void CPU::op_irq(uint16 vector) {
@@ -162,12 +172,17 @@ void CPU::reset() {
   status.virq_pos = 0x0000;
 
   status.rom_speed = 8;
+  bus.map_speed(status.rom_speed);
 
   status.joy1 = 0x0000;
   status.joy2 = 0x0000;
   status.joy3 = 0x0000;
   status.joy4 = 0x0000;
 
+  idle_skip = config().cpu.idle_skip;
+  idle_history[0] = idle_history[1] = ~0;
+  memset(&idle_statistics, 0, sizeof idle_statistics);
+
   dma_reset();
 }
 
@@ -3,7 +3,7 @@
 class CPU : public Processor, public CPUcore, public PPUcounter, public MMIO {
 public:
   enum : bool { Threaded = true };
-  array<Processor*> coprocessors;
+  array<Coprocessor*> coprocessors;
   alwaysinline void step(unsigned clocks);
   void synchronize_smp();
   void synchronize_ppu();
@@ -20,9 +20,17 @@ public:
   debugvirtual void op_write(unsigned addr, uint8 data);
 
   void enter();
+  void mmio_map();
   void power();
   void reset();
 
+  //idle loop fast-forward (config().cpu.idle_skip)
+  struct IdleStatistics {
+    uint64 loops;   //polling loops fast-forwarded
+    uint64 waits;   //WAI instructions fast-forwarded
+    uint64 clocks;  //S-CPU clocks skipped
+  } idle_statistics;
+
   void serialize(serializer&);
   CPU();
   ~CPU();
@@ -51,6 +59,14 @@ private:
   //memory
   unsigned speed(unsigned addr) const;
 
+  //idle
+  bool idle_skip;
+  uint32 idle_history[2];  //PCs of the two most recent opcodes
+  unsigned idle_window();
+  bool idle_fetch(unsigned offset, uint8 &data, unsigned &period);
+  void idle_loop();
+  void op_wai_idle();
+
   //dma
   bool dma_transfer_valid(uint8 bbus, unsigned abus);
   bool dma_addr_valid(unsigned abus);
@@ -61,6 +77,9 @@ private:
   unsigned dma_addr(unsigned i);
   unsigned hdma_addr(unsigned i);
   unsigned hdma_iaddr(unsigned i);
+  bool dma_block_valid(unsigned i);
+  unsigned dma_block_length(unsigned i);
+  void dma_block(unsigned i, unsigned index, unsigned length);
   void dma_run();
   bool hdma_active_after(unsigned i);
   void hdma_update(unsigned i);
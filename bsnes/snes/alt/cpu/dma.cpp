@@ -71,6 +71,49 @@ unsigned CPU::hdma_iaddr(unsigned i) {
   return (channel[i].indirect_bank << 16) | (channel[i].indirect_addr++);
 }
 
+//block transfers
+//
+//uploads from ROM or RAM to VMDATA or CGDATA make up most DMA time. while the
+//S-PPU is in forced blank or vblank these writes cannot affect rendering, so when
+//no event is due before the last byte (see idle_window()) the bytes are moved
+//without per-byte timing, and their clocks are added in one step beforehand.
+
+//A-bus to VMDATAL, VMDATAH and/or CGDATA
+bool CPU::dma_block_valid(unsigned i) {
+  if(channel[i].direction == 1) return false;
+  for(unsigned index = 0; index < 4; index++) {
+    uint8 bbus = dma_bbus(i, index);
+    if(bbus != 0x18 && bbus != 0x19 && bbus != 0x22) return false;
+  }
+  return true;
+}
+
+//number of bytes that can be moved as a block now, limited to the source page
+unsigned CPU::dma_block_length(unsigned i) {
+  if(ppu.regs.display_disabled == false && vcounter() < (ppu.overscan() == false ? 225 : 240)) return 0;
+  #if defined(CHEAT_SYSTEM)
+  if(cheat.active()) return 0;
+  #endif
+
+  //only ROM and RAM reads are free of side effects and timing
+  unsigned addr = (channel[i].source_bank << 16) | channel[i].source_addr;
+  if(bus.page[addr >> 8].read_data == 0 || dma_addr_valid(addr) == false) return 0;
+
+  unsigned length = channel[i].transfer_size ? channel[i].transfer_size : 0x10000;
+  if(channel[i].fixed_transfer == false) {
+    length = min(length, channel[i].reverse_transfer == false ? 0x100 - (addr & 0xff) : (addr & 0xff) + 1);
+  }
+  return min(length, idle_window() / 8);
+}
+
+void CPU::dma_block(unsigned i, unsigned index, unsigned length) {
+  add_clocks(length * 8);
+  for(unsigned n = 0; n < length; n++) {
+    uint8 data = dma_read(dma_addr(i));
+    ppu.mmio_write(0x2100 | dma_bbus(i, index + n), data);
+  }
+}
+
 void CPU::dma_run() {
   add_clocks(16);
 
@@ -78,10 +121,21 @@ void CPU::dma_run() {
     if(channel[i].dma_enabled == false) continue;
     add_clocks(8);
 
+    bool block = dma_block_valid(i);
     unsigned index = 0;
-    do {
+    while(true) {
+      unsigned length = block ? dma_block_length(i) : 0;
+      if(length > 1) {
+        dma_block(i, index, length);
+        index += length;
+        channel[i].transfer_size -= length;
+        if(channel[i].transfer_size == 0) break;
+        continue;
+      }
+
       dma_transfer(channel[i].direction, dma_bbus(i, index++), dma_addr(i));
-    } while(channel[i].dma_enabled && --channel[i].transfer_size);
+      if(channel[i].dma_enabled == false || --channel[i].transfer_size == 0) break;
+    }
 
     channel[i].dma_enabled = false;
   }
@@ -0,0 +1,139 @@
+#ifdef CPU_CPP
+
+//idle loop fast-forward (config().cpu.idle_skip)
+//
+//games spend much of each frame in WAI, or in a two-opcode loop polling
+//$4212 or a WRAM flag set by an interrupt handler. until the next scanline,
+//queue or H/V IRQ event nothing can change the outcome of such a loop, and
+//no other thread observes the S-CPU, so whole iterations are skipped with a
+//single add_clocks() call. the final iteration is always interpreted, so
+//registers and timing are identical to running every opcode.
+
+//S-CPU clocks that can elapse before any event may end the loop,
+//or zero when one already has (or the debugger has to see every opcode)
+unsigned CPU::idle_window() {
+  if(scheduler.synchronizing()) return 0;
+  if(status.nmi_transition || status.nmi_pending || status.irq_lock) return 0;
+  if(status.irq_line || status.irq_transition || status.irq_pending || regs.irq) return 0;
+
+  #if defined(DEBUGGER)
+  if(debugger.step_cpu || cpu.step_event || debugger.range_breakpoint.size()) return 0;
+  #endif
+
+  unsigned window = min(lineclocks() - hcounter(), queue.remaining()) - 1;
+
+  if(status.hirq_enabled) {
+    unsigned cpu_time = hcounter();
+    unsigned irq_time = status.hirq_pos * 4;
+    if(status.virq_enabled) {
+      cpu_time += vcounter() * 1364;
+      irq_time += status.virq_pos * 1364;
+      if(cpu_time > irq_time) irq_time += fieldlines() * 1364;
+    } else {
+      if(cpu_time > irq_time) irq_time += 1364;
+    }
+    window = min(window, irq_time - cpu_time);
+  } else if(status.virq_enabled) {
+    //the IRQ line rises on the first add_clocks() of the V-IRQ scanline
+    if(!status.irq_valid && vcounter() == status.virq_pos) return 0;
+  }
+
+  return window;
+}
+
+//WAI cycles are 6 clocks each; skip all but those that may end the wait
+void CPU::op_wai_idle() {
+  if(idle_skip == false) return;
+  unsigned clocks = idle_window() / 6 * 6;
+  if(clocks == 0) return;
+
+  idle_statistics.waits++;
+  idle_statistics.clocks += clocks;
+  add_clocks(clocks);
+}
+
+//reads an opcode byte at PC + offset ahead of execution, adding its fetch time to period;
+//only ROM and WRAM can be read ahead, as neither has side effects
+bool CPU::idle_fetch(unsigned offset, uint8 &data, unsigned &period) {
+  unsigned addr = (regs.pc.b << 16) + (uint16)(regs.pc.w + offset);
+  Memory *access = bus.page[addr >> 8].access;
+  if(access != &memory::cartrom && access != &memory::wram) return false;
+
+  data = bus.read(addr);
+  period += speed(addr);
+  return true;
+}
+
+//called before each opcode. recognizes a load or BIT of $4212 or WRAM,
+//followed by a branch back to it that will be taken again:
+//  loop: lda $4212 / bit $4212 / lda $7e0010 / lda $10 ...
+//        bpl loop  / bmi loop  / beq loop    / bne loop
+void CPU::idle_loop() {
+  uint32 pc = regs.pc.d;
+  bool repeated = pc == idle_history[1];
+  idle_history[1] = idle_history[0];
+  idle_history[0] = pc;
+  if(repeated == false || regs.p.m == 0) return;
+
+  uint8 code[6];
+  unsigned period = 0;
+  if(idle_fetch(0, code[0], period) == false) return;
+
+  unsigned length;
+  switch(code[0]) {
+    case 0x24: case 0xa5: length = 2; break;  //bit dp, lda dp
+    case 0x2c: case 0xad: length = 3; break;  //bit addr, lda addr
+    case 0xaf: length = 4; break;             //lda long
+    default: return;
+  }
+  for(unsigned n = 1; n < length + 2; n++) {
+    if(idle_fetch(n, code[n], period) == false) return;
+  }
+
+  uint16 next = regs.pc.w + length + 2;
+  uint16 target = next + (int8)code[length + 1];
+  if(target != regs.pc.w) return;
+
+  uint8 bit;
+  bool val;
+  switch(code[length]) {
+    case 0x10: bit = 0x80; val = false; break;  //bpl
+    case 0x30: bit = 0x80; val = true;  break;  //bmi
+    case 0xd0: bit = 0x02; val = false; break;  //bne
+    case 0xf0: bit = 0x02; val = true;  break;  //beq
+    default: return;
+  }
+
+  unsigned addr;
+  if(length == 2) {
+    if(regs.d.l != 0x00) period += 6;
+    addr = regs.e && regs.d.l == 0x00 ? regs.d + code[1] : (regs.d + code[1]) & 0xffff;
+  } else if(length == 3) {
+    addr = ((regs.db << 16) + (code[1] | code[2] << 8)) & 0xffffff;
+  } else {
+    addr = code[1] | code[2] << 8 | code[3] << 16;
+  }
+
+  //only the vblank flag of $4212 is stable for the rest of the scanline
+  Memory *access = bus.page[addr >> 8].access;
+  bool hvbjoy = access == &memory::mmio && (addr & 0x40ffff) == 0x4212 && bit == 0x80;
+  if(access != &memory::wram && hvbjoy == false) return;
+
+  uint8 data = bus.read(addr);
+  period += speed(addr);
+  if(bit == 0x02 && code[0] < 0x80) data &= regs.a.l;  //bit sets Z from A & data
+  bool flag = bit == 0x80 ? data & 0x80 : data == 0;
+  if(flag != val) return;  //the loop exits on this iteration
+
+  period += 6;
+  if(regs.e && (next & 0xff00) != (target & 0xff00)) period += 6;
+
+  unsigned clocks = idle_window() / period * period;
+  if(clocks == 0) return;
+
+  idle_statistics.loops++;
+  idle_statistics.clocks += clocks;
+  add_clocks(clocks);
+}
+
+#endif
@@ -28,13 +28,7 @@ void CPU::op_write(unsigned addr, uint8 data) {
 }
 
 unsigned CPU::speed(unsigned addr) const {
-  if(addr & 0x408000) {
-    if(addr & 0x800000) return status.rom_speed;
-    return 8;
-  }
-  if((addr + 0x6000) & 0x4000) return 8;
-  if((addr - 0x4000) & 0x7e00) return 6;
-  return 12;
+  return bus.page[addr >> 8].speed;
 }
 
 #endif
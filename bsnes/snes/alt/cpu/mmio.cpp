@@ -220,7 +220,8 @@ void CPU::mmio_write(unsigned addr, uint8 data) {
     }
 
     case 0x420d: {
-      status.rom_speed = data & 1 ? 6 : 8;
+      unsigned rom_speed = data & 1 ? 6 : 8;
+      if(rom_speed != status.rom_speed) bus.map_speed(status.rom_speed = rom_speed);
       return;
     }
   }
@@ -296,4 +297,11 @@ void CPU::mmio_write(unsigned addr, uint8 data) {
   }
 }
 
+void CPU::mmio_map() {
+  memory::mmio.map(0x2180, 0x2183, *this);
+  memory::mmio.map(0x4016, 0x4017, *this);
+  memory::mmio.map(0x4200, 0x421f, *this);
+  memory::mmio.map(0x4300, 0x437f, *this);
+}
+
 #endif
@@ -59,7 +59,7 @@ void CPU::add_clocks(unsigned clocks) {
 }
 
 void CPU::scanline() {
-  synchronize_smp();
+  if(smp.lockstep || smp.clock < -smp.sync_window) synchronize_smp();
   synchronize_ppu();
   synchronize_coprocessor();
   system.scanline();
@@ -3,6 +3,7 @@
 class DSP : public Processor {
 public:
   enum : bool { Threaded = false };
+  enum : bool { Batched = false };
   enum : bool { SupportsChannelEnable = true };
 
   alwaysinline void step(unsigned clocks);
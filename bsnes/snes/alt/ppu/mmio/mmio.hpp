@@ -199,5 +199,7 @@ uint8 mmio_r213f();  //STAT78
 
 uint8 mmio_read(unsigned addr);
 void mmio_write(unsigned addr, uint8 data);
+template<uint8 (PPU::*Read)()> static uint8 mmio_reader(MMIO&, unsigned);
+template<void (PPU::*Write)(uint8)> static void mmio_writer(MMIO&, unsigned, uint8);
 
 void latch_counters();
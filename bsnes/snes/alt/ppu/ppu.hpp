@@ -60,6 +60,7 @@ public:
   void render_scanline();
   void frame();
   void enter();
+  void mmio_map();
   void power();
   void reset();
 
@@ -125,12 +125,46 @@ void Cartridge::load(Mode cartridge_mode, const lstring &xml_list) {
   string hash;
   foreach(n, shahash) hash << hex<2>(n);
   sha256 = hash;
+  share_rom();
 
   bus.load_cart();
   system.serialize_init();
   loaded = true;
 }
 
+//with config().path.romcache set, a private copy of the ROM is replaced by a read-only
+//mapping of <romcache>/<sha256>.rom, written by the first process to load the image.
+//all processes running the same game then share its pages in the host page cache,
+//and the host unmaps them once the last one exits.
+void Cartridge::share_rom() {
+  string path = config().path.romcache;
+  if(path == "" || memory::cartrom.size() == 0 || memory::cartrom.mapped()) return;
+  if(!strend(path, "/") && !strend(path, "\\")) path.append("/");
+  string filename = string(path, sha256(), ".rom");
+
+  if(file::exists(filename) == false) {
+    //written under a name unique to this process and renamed, so no process ever maps
+    //a partial image, nor writes to the same temporary file as another one
+    string temporary = string(filename, ".", (unsigned)getpid(), ".", hex<16>(std::chrono::steady_clock::now().time_since_epoch().count()));
+    file fp;
+    if(fp.open(temporary, file::mode::write) == false) return;
+    fp.write(memory::cartrom.data(), memory::cartrom.size());
+    fp.close();
+    if(::rename(temporary, filename) != 0) ::remove(temporary);
+  }
+
+  filemap fp;
+  if(fp.open(filename, filemap::mode::read) == false) return;
+  bool identical = fp.size() == memory::cartrom.size() && !memcmp(fp.data(), memory::cartrom.data(), fp.size());
+  fp.close();
+
+  //a damaged cache file would otherwise disable sharing for this image for good;
+  //removing it lets the next process to load the image write it again
+  if(!identical) ::remove(filename);
+
+  if(identical && memory::cartrom.map(filename)) memory::cartrom.write_protect(true);
+}
+
 void Cartridge::unload() {
   memory::cartrom.reset();
   memory::cartram.reset();
@@ -87,6 +87,7 @@ public:
   ~Cartridge();
 
 private:
+  void share_rom();
   void parse_xml(const lstring&);
   void parse_xml_cartridge(const char*);
   void parse_xml_bsx(const char*);
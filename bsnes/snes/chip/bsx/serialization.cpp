@@ -54,7 +54,8 @@ void BSXBase::serialize(serializer &s) {
 		s.integer(elapsed);
 		start_time = now - elapsed;
 	} else {
-		elapsed = now - start_time;
+		//host time would make every state hash differ
+		elapsed = system.hashing() ? 0 : now - start_time;
 		s.integer(elapsed);
 	}
 }
@@ -1,6 +1,18 @@
 struct Coprocessor : Processor {
   alwaysinline void step(unsigned clocks);
   alwaysinline void synchronize_cpu();
+  alwaysinline void synchronize();
+
+  //sleep state: a coprocessor that can only spin in place until the S-CPU writes
+  //to one of its registers is not resumed by the S-CPU while asleep. instead,
+  //idle() advances it to where its idle loop would next have yielded.
+  bool asleep;
+  inline void sleep();
+  alwaysinline void wake();
+  virtual void idle() {}
+
+  inline void create(void (*entrypoint)(), unsigned frequency);
+  Coprocessor() : asleep(false) {}
 };
 
 #include <chip/supergameboy/supergameboy.hpp>
@@ -24,3 +36,29 @@ void Coprocessor::step(unsigned clocks) {
 void Coprocessor::synchronize_cpu() {
   if(clock >= 0) scheduler.resume(cpu.thread);
 }
+
+//called from the S-CPU thread: catch up with the S-CPU, if behind.
+//while saving state, a sleeping thread is still resumed so it can reach its synchronization point.
+void Coprocessor::synchronize() {
+  if(clock >= 0) return;
+  if(asleep && !scheduler.synchronizing()) return idle();
+  scheduler.resume(thread);
+}
+
+//called from the coprocessor thread in place of its idle loop;
+//returns once the coprocessor thread is resumed again
+void Coprocessor::sleep() {
+  asleep = true;
+  idle();
+  scheduler.resume(cpu.thread);
+  asleep = false;
+}
+
+void Coprocessor::wake() {
+  asleep = false;
+}
+
+void Coprocessor::create(void (*entrypoint)(), unsigned frequency) {
+  Processor::create(entrypoint, frequency);
+  asleep = false;
+}
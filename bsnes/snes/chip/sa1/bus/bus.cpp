@@ -96,6 +96,12 @@ void VSPROM::write(unsigned addr, uint8 data) {
   memory::cartrom.write(addr, data);
 }
 
+//every page but the one holding the vectors reads the ROM verbatim
+uint8* VSPROM::direct_read(unsigned offset) {
+  if((offset & 0xffff00) == 0x007f00) return 0;
+  return memory::cartrom.direct_read(offset);
+}
+
 //=======
 //SA1IRAM
 //=======
@@ -177,54 +183,27 @@ unsigned BitmapRAM::size() const {
   return 0x100000;
 }
 
+//each BW-RAM byte holds two 4bpp pixels (BBF = 0) or four 2bpp pixels (BBF = 1),
+//the first pixel in the low bits
 uint8 BitmapRAM::read(unsigned addr) {
   if(!debugger_access()) sa1.synchronize_cpu();
 
-  if(sa1.mmio.bbf == 0) {
-    //4bpp
-    unsigned shift = addr & 1;
-    addr = (addr >> 1) & (memory::cartram.size() - 1);
-    switch(shift) { default:
-      case 0: return (memory::cartram.read(addr) >> 0) & 15;
-      case 1: return (memory::cartram.read(addr) >> 4) & 15;
-    }
-  } else {
-    //2bpp
-    unsigned shift = addr & 3;
-    addr = (addr >> 2) & (memory::cartram.size() - 1);
-    switch(shift) { default:
-      case 0: return (memory::cartram.read(addr) >> 0) & 3;
-      case 1: return (memory::cartram.read(addr) >> 2) & 3;
-      case 2: return (memory::cartram.read(addr) >> 4) & 3;
-      case 3: return (memory::cartram.read(addr) >> 6) & 3;
-    }
-  }
+  unsigned scale = 1 + sa1.mmio.bbf;  //log2(pixels per byte)
+  unsigned bits = 8 >> scale;
+  unsigned shift = (addr & ((1 << scale) - 1)) * bits;
+  addr = (addr >> scale) & (memory::cartram.size() - 1);
+  return (memory::cartram.read(addr) >> shift) & ((1 << bits) - 1);
 }
 
 void BitmapRAM::write(unsigned addr, uint8 data) {
   if(!debugger_access()) sa1.synchronize_cpu();
 
-  if(sa1.mmio.bbf == 0) {
-    //4bpp
-    unsigned shift = addr & 1;
-    addr = (addr >> 1) & (memory::cartram.size() - 1);
-    switch(shift) { default:
-      case 0: data = (memory::cartram.read(addr) & 0xf0) | ((data & 15) << 0); break;
-      case 1: data = (memory::cartram.read(addr) & 0x0f) | ((data & 15) << 4); break;
-    }
-  } else {
-    //2bpp
-    unsigned shift = addr & 3;
-    addr = (addr >> 2) & (memory::cartram.size() - 1);
-    switch(shift) { default:
-      case 0: data = (memory::cartram.read(addr) & 0xfc) | ((data &  3) << 0); break;
-      case 1: data = (memory::cartram.read(addr) & 0xf3) | ((data &  3) << 2); break;
-      case 2: data = (memory::cartram.read(addr) & 0xcf) | ((data &  3) << 4); break;
-      case 3: data = (memory::cartram.read(addr) & 0x3f) | ((data &  3) << 6); break;
-    }
-  }
-
-  memory::cartram.write(addr, data);
+  unsigned scale = 1 + sa1.mmio.bbf;
+  unsigned bits = 8 >> scale;
+  unsigned shift = (addr & ((1 << scale) - 1)) * bits;
+  unsigned mask = ((1 << bits) - 1) << shift;
+  addr = (addr >> scale) & (memory::cartram.size() - 1);
+  memory::cartram.write(addr, (memory::cartram.read(addr) & ~mask) | ((data << shift) & mask));
 }
 
 #endif
@@ -16,6 +16,7 @@ struct VSPROM : Memory {
   unsigned size() const;
   alwaysinline uint8 read(unsigned);
   alwaysinline void write(unsigned, uint8);
+  uint8* direct_read(unsigned offset);
 };
 
 struct CPUIRAM : Memory {
@@ -554,6 +554,7 @@ uint8 SA1::mmio_read(unsigned addr) {
 
 void SA1::mmio_write(unsigned addr, uint8 data) {
   (co_active() == cpu.thread ? cpu.synchronize_coprocessor() : synchronize_cpu());
+  wake();
   switch(addr) {
     case 0x2200: return mmio_w2200(data);
     case 0x2201: return mmio_w2201(data);
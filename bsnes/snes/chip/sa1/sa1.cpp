@@ -27,7 +27,13 @@ void SA1::enter() {
     if(mmio.sa1_rdyb || mmio.sa1_resb) {
       //SA-1 co-processor is asleep
       tick();
-      synchronize_cpu();
+      if(mmio.hen || mmio.ven || scheduler.synchronizing()) {
+        synchronize_cpu();
+      } else {
+        //with the timer IRQ off, nothing happens until the S-CPU writes $2200
+        sleep_wai = false;
+        sleep();
+      }
       continue;
     }
 
@@ -38,7 +44,7 @@ void SA1::enter() {
 
     op_step();
 
-    (this->*opcode_table[op_readpc()])();
+    op_exec(op_readpc());
   }
 }
 
@@ -117,6 +123,59 @@ void SA1::tick() {
   }
 }
 
+//while asleep: tick until the SA-1 would next have yielded to the S-CPU
+void SA1::idle() {
+  uint64 length = 2 * (uint64)cpu.frequency;
+  uint64 ticks = clock < 0 ? ((uint64)-clock + length - 1) / length : 0;
+  if(sleep_wai) {
+    //WAI only yields from tick(), when tick_counter wraps
+    ticks = max(ticks, (uint64)1);
+    ticks += (uint8)(0 - (status.tick_counter + ticks));
+  }
+  if(ticks == 0) return;
+
+  clock += ticks * length;
+  status.tick_counter += ticks;
+
+  //the timer IRQ is disabled, so only the counters advance
+  unsigned clocks = ticks * 2;
+  if(mmio.hvselb == 0) {
+    //HV timer
+    while(clocks) {
+      unsigned wrap = status.hcounter >= 1362 ? 2 : (1364 - status.hcounter + 1) & ~1;
+      if(clocks < wrap) {
+        status.hcounter += clocks;
+        break;
+      }
+      clocks -= wrap;
+      status.hcounter = 0;
+      if(++status.vcounter >= status.scanlines) status.vcounter = 0;
+    }
+  } else {
+    //linear timer
+    clocks += status.hcounter;
+    status.vcounter = (status.vcounter + (clocks >> 11)) & 0x01ff;
+    status.hcounter = clocks & 0x07ff;
+  }
+}
+
+//WAI can only end with an interrupt; with the timer IRQ off, only an S-CPU write can raise one
+void SA1::op_wai_idle() {
+  if(mmio.hen || mmio.ven || scheduler.synchronizing()) return;
+  if(!regs.wai || interrupt_raised()) return;
+  sleep_wai = true;
+  sleep();
+}
+
+//true if last_cycle() would raise an interrupt
+bool SA1::interrupt_raised() {
+  if(mmio.sa1_nmi && !mmio.sa1_nmicl) return true;
+  if(regs.p.i) return false;
+  return (mmio.timer_irqen && !mmio.timer_irqcl)
+      || (mmio.dma_irqen && !mmio.dma_irqcl)
+      || (mmio.sa1_irq && !mmio.sa1_irqcl);
+}
+
 void SA1::trigger_irq() {
   mmio.timer_irqfl = true;
   if(mmio.timer_irqen) mmio.timer_irqcl = 0;
@@ -157,6 +216,7 @@ void SA1::reset() {
   CPUcore::update_table();
 
   status.tick_counter = 0;
+  sleep_wai = false;
 
   status.interrupt_pending = false;
   status.interrupt_vector  = 0x0000;
@@ -21,6 +21,10 @@ public:
   void enter();
   debugvirtual void interrupt(uint16 vector);
   void tick();
+  void idle();
+  void op_wai_idle();
+  bool interrupt_raised();
+  bool sleep_wai;  //asleep in WAI rather than halted by $2200
   
   // used by the SA-1 debugger prior to executing instructions
   debugvirtual void op_step() {};
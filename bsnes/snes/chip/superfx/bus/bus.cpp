@@ -30,7 +30,7 @@ unsigned SuperFXGSUROM::size() const {
 uint8 SuperFXGSUROM::read(unsigned addr) {
   if(!debugger_access()) {
     while(!superfx.regs.scmr.ron) {
-      superfx.add_clocks(6);
+      superfx.stall();
       superfx.synchronize_cpu();
       if (scheduler.synchronizing()) break;
     }
@@ -50,7 +50,7 @@ unsigned SuperFXGSURAM::size() const {
 uint8 SuperFXGSURAM::read(unsigned addr) {
   if(!debugger_access()) {
     while(!superfx.regs.scmr.ran) {
-      superfx.add_clocks(6);
+      superfx.stall();
       superfx.synchronize_cpu();
       if (scheduler.synchronizing()) break;
     }
@@ -61,7 +61,7 @@ uint8 SuperFXGSURAM::read(unsigned addr) {
 void SuperFXGSURAM::write(unsigned addr, uint8 data) {
   if(!debugger_access()) {
     while(!superfx.regs.scmr.ran) {
-      superfx.add_clocks(6);
+      superfx.stall();
       superfx.synchronize_cpu();
       if (scheduler.synchronizing()) break;
     }
@@ -56,6 +56,7 @@ uint8 SuperFX::mmio_read(unsigned addr) {
 
 void SuperFX::mmio_write(unsigned addr, uint8 data) {
   cpu.synchronize_coprocessor();
+  wake();
 
   if(addr >= 0x3100 && addr <= 0x32ff) {
     return cache_mmio_write(addr - 0x3100, data);
@@ -25,7 +25,7 @@ void SuperFX::enter() {
     scheduler.synchronize();
 
     if(regs.sfr.g == 0) {
-      add_clocks(6);
+      stall();
       continue;
     }
 
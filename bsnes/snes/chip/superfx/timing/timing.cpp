@@ -29,6 +29,22 @@ void SuperFX::add_clocks(unsigned clocks) {
   synchronize_cpu();
 }
 
+//one idle step while stopped, or while waiting for ROM/RAM access to be returned.
+//with no buffered access in flight, nothing can change until the S-CPU writes to
+//a register, so the GSU sleeps until then.
+void SuperFX::stall() {
+  if(regs.romcl || regs.ramcl || scheduler.synchronizing()) return add_clocks(6);
+  step(6);
+  sleep();
+}
+
+//while asleep, the GSU would have stalled until caught up with the S-CPU
+void SuperFX::idle() {
+  if(clock >= 0) return;
+  uint64 length = 6 * (uint64)cpu.frequency;
+  clock += ((uint64)-clock + length - 1) / length * length;
+}
+
 void SuperFX::rombuffer_sync() {
   if(regs.romcl) add_clocks(regs.romcl);
 }
@@ -4,6 +4,8 @@ inline unsigned memory_access_speed();
 bool r15_modified;
 
 void add_clocks(unsigned clocks);
+void stall();
+void idle();
 
 void rombuffer_sync();
 void rombuffer_update();
@@ -17,9 +17,11 @@ Configuration::Configuration() {
   cpu.ntsc_frequency  = 21477272;  //315 / 88 * 6000000
   cpu.pal_frequency   = 21281370;
   cpu.wram_init_value = 0x55;
+  cpu.idle_skip       = false;      //fast-forward idle loops (alt/cpu only)
 
   smp.ntsc_frequency = 24607104;   //32040.5 * 768
   smp.pal_frequency  = 24607104;
+  smp.sync_window    = 0;          //0 = synchronize S-CPU and S-SMP every opcode
 
   ppu1.version = 1;
   ppu2.version = 3;
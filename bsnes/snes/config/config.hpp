@@ -11,11 +11,13 @@ struct Configuration {
     unsigned ntsc_frequency;
     unsigned pal_frequency;
     unsigned wram_init_value;
+    bool idle_skip;
   } cpu;
 
   struct SMP {
     unsigned ntsc_frequency;
     unsigned pal_frequency;
+    unsigned sync_window;
   } smp;
 
   struct PPU1 {
@@ -29,6 +31,7 @@ struct Configuration {
   struct Path {
     string firmware;
     string bsxdat;
+    string romcache;  //directory of ROM images shared between processes; empty = disabled
   } path;
 
   struct Satellaview {
@@ -14,6 +14,7 @@ public:
   virtual void op_write(uint32_t addr, uint8_t data) = 0;
   virtual void last_cycle() = 0;
   virtual bool interrupt_pending() = 0;
+  virtual void op_wai_idle() {}  //may fast-forward WAI cycles that cannot end the wait
 
   virtual uint8 disassembler_read(uint32 addr);
 
@@ -200,6 +201,14 @@ public:
   void initialize_opcode_table();
   void update_table();
 
+  //executes one opcode in the current M/X mode; builds with cpucore=switch
+  //dispatch through a switch statement rather than a pointer-to-member call
+  #if defined(CPUCORE_SWITCH)
+  void op_exec(uint8 opcode);
+  #else
+  alwaysinline void op_exec(uint8 opcode) { (this->*opcode_table[opcode])(); }
+  #endif
+
   enum {
     table_MX =    0,  // 8-bit accumulator,  8-bit index
     table_Mx =  256,  // 8-bit accumulator, 16-bit index
@@ -66,6 +66,7 @@ void CPUcore::op_wai() {
   regs.wai = true;
   while(regs.wai && !scheduler.synchronizing()) {
 L   op_io();
+    op_wai_idle();
   }
   op_io();
 }
@@ -21,10 +21,14 @@ namespace SNES {
 void CPU::step(unsigned clocks) {
   smp.clock -= clocks * (uint64)smp.frequency;
   ppu.clock -= clocks;
+  #if defined(SCHEDULER_QUEUE)
+  scheduler.coprocessor_queue.step(clocks);
+  #else
   for(unsigned i = 0; i < coprocessors.size(); i++) {
     Processor &chip = *coprocessors[i];
     chip.clock -= clocks * (uint64)chip.frequency;
   }
+  #endif
 }
 
 void CPU::synchronize_smp() {
@@ -44,10 +48,13 @@ void CPU::synchronize_ppu() {
 }
 
 void CPU::synchronize_coprocessor() {
+  #if defined(SCHEDULER_QUEUE)
+  scheduler.coprocessor_queue.synchronize();
+  #else
   for(unsigned i = 0; i < coprocessors.size(); i++) {
-    Processor &chip = *coprocessors[i];
-    if(chip.clock < 0) scheduler.resume(chip.thread);
+    coprocessors[i]->synchronize();
   }
+  #endif
 }
 
 void CPU::Enter() { cpu.enter(); }
@@ -83,7 +90,8 @@ void CPU::enter() {
 }
 
 void CPU::op_step() {
-  (this->*opcode_table[op_readpc()])();
+  op_exec(op_readpc());
+  if(smp.lockstep) synchronize_smp();
 }
 
 void CPU::op_irq() {
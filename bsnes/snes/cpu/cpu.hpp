@@ -1,7 +1,7 @@
 class CPU : public Processor, public CPUcore, public PPUcounter, public MMIO {
 public:
   enum : bool { Threaded = true };
-  array<Processor*> coprocessors;
+  array<Coprocessor*> coprocessors;
   alwaysinline void step(unsigned clocks);
   void synchronize_smp();
   void synchronize_ppu();
@@ -13,6 +13,7 @@ public:
   alwaysinline bool refresh() { return status.dram_refresh == 1; }
 
   void enter();
+  void mmio_map();
   void power();
   void reset();
 
@@ -88,7 +88,7 @@ void CPUDebugger::op_step() {
   }
 
   CPU::op_step();
-  synchronize_smp();
+  if(debugger.step_smp) synchronize_smp();
   
   if (debugger.step_cpu) {
     uint8 hvb_new = hvbjoy();
@@ -209,6 +209,15 @@ bool CPUDebugger::property(unsigned id, string &name, string &value) {
   //internal
   item("S-CPU open bus", string("0x", hex<2>(regs.mdr)));
 
+#if defined(ALT_CPU_CPP)
+  //idle loop fast-forward
+  item("Idle Loop Skip", "");
+  item("Enabled", idle_skip);
+  item("Loops Skipped", (unsigned)idle_statistics.loops);
+  item("WAI Skipped", (unsigned)idle_statistics.waits);
+  item("Clocks Skipped (thousands)", (unsigned)(idle_statistics.clocks / 1000));
+#endif
+
   //$2181-2183
   item("$2181-$2183", "");
   item("WRAM Address", string("0x", hex<6>(status.wram_addr)));
@@ -156,7 +156,8 @@ void CPU::mmio_w420c(uint8 data) {
 
 //MEMSEL
 void CPU::mmio_w420d(uint8 data) {
-  status.rom_speed = (data & 1 ? 6 : 8);
+  unsigned rom_speed = (data & 1 ? 6 : 8);
+  if(rom_speed != status.rom_speed) bus.map_speed(status.rom_speed = rom_speed);
 }
 
 //RDNMI
@@ -396,6 +397,7 @@ void CPU::mmio_reset() {
 
   //$420d
   status.rom_speed = 8;
+  bus.map_speed(status.rom_speed);
 
   //$4214-$4217
   status.rddiv = 0x0000;
@@ -512,4 +514,52 @@ void CPU::mmio_write(unsigned addr, uint8 data) {
   }
 }
 
+//registers get handlers of their own, so accesses skip the switches above
+template<uint8 (CPU::*Read)()> uint8 CPU::mmio_reader(MMIO &access, unsigned) {
+  return (static_cast<CPU&>(access).*Read)();
+}
+
+template<void (CPU::*Write)(uint8)> void CPU::mmio_writer(MMIO &access, unsigned, uint8 data) {
+  (static_cast<CPU&>(access).*Write)(data);
+}
+
+template<uint8 (CPU::*Read)(uint8)> uint8 CPU::mmio_channel_reader(MMIO &access, unsigned addr) {
+  return (static_cast<CPU&>(access).*Read)((addr >> 4) & 7);
+}
+
+template<void (CPU::*Write)(uint8, uint8)> void CPU::mmio_channel_writer(MMIO &access, unsigned addr, uint8 data) {
+  (static_cast<CPU&>(access).*Write)((addr >> 4) & 7, data);
+}
+
+void CPU::mmio_map() {
+  memory::mmio.map(0x2180, 0x2183, *this);
+  memory::mmio.map(0x4016, 0x4017, *this);
+  memory::mmio.map(0x4200, 0x421f, *this);
+  memory::mmio.map(0x4300, 0x437f, *this);
+
+  #define r(addr) memory::mmio.map(0x##addr, *this, &CPU::mmio_reader<&CPU::mmio_r##addr>, 0)
+  #define w(addr) memory::mmio.map(0x##addr, *this, 0, &CPU::mmio_writer<&CPU::mmio_w##addr>)
+  #define rw(addr) memory::mmio.map(0x##addr, *this, \
+    &CPU::mmio_reader<&CPU::mmio_r##addr>, &CPU::mmio_writer<&CPU::mmio_w##addr>)
+  rw(2180); w(2181); w(2182); w(2183);
+  rw(4016); r(4017);
+  w(4200); w(4201); w(4202); w(4203); w(4204); w(4205); w(4206); w(4207);
+  w(4208); w(4209); w(420a); w(420b); w(420c); w(420d);
+  r(4210); r(4211); r(4212); r(4213); r(4214); r(4215); r(4216); r(4217);
+  r(4218); r(4219); r(421a); r(421b); r(421c); r(421d); r(421e); r(421f);
+  #undef rw
+  #undef w
+  #undef r
+
+  #define channel(n, reg) memory::mmio.map(0x4300 | i << 4 | n, *this, \
+    &CPU::mmio_channel_reader<&CPU::mmio_r43x##reg>, &CPU::mmio_channel_writer<&CPU::mmio_w43x##reg>)
+  for(unsigned i = 0; i < 8; i++) {
+    channel(0x0, 0); channel(0x1, 1); channel(0x2, 2); channel(0x3, 3);
+    channel(0x4, 4); channel(0x5, 5); channel(0x6, 6); channel(0x7, 7);
+    channel(0x8, 8); channel(0x9, 9); channel(0xa, a); channel(0xb, b);
+    channel(0xf, b);  //mirror of $43xb
+  }
+  #undef channel
+}
+
 #endif
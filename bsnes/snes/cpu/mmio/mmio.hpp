@@ -2,6 +2,10 @@ void mmio_power();
 void mmio_reset();
 uint8 mmio_read(unsigned addr);
 void mmio_write(unsigned addr, uint8 data);
+template<uint8 (CPU::*Read)()> static uint8 mmio_reader(MMIO&, unsigned);
+template<void (CPU::*Write)(uint8)> static void mmio_writer(MMIO&, unsigned, uint8);
+template<uint8 (CPU::*Read)(uint8)> static uint8 mmio_channel_reader(MMIO&, unsigned);
+template<void (CPU::*Write)(uint8, uint8)> static void mmio_channel_writer(MMIO&, unsigned, uint8);
 
 debugvirtual uint8 mmio_r2180();
 uint8 mmio_r4016();
@@ -68,6 +68,7 @@ void CPU::serialize(serializer &s) {
   s.integer(status.virq_pos);
 
   s.integer(status.rom_speed);
+  if(s.mode() == serializer::Load) bus.map_speed(status.rom_speed);
 
   s.integer(status.auto_joypad_active);
   s.integer(status.auto_joypad_latch);
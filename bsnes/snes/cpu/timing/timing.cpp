@@ -63,7 +63,7 @@ void CPU::scanline() {
 
   //forcefully sync S-CPU to other processors, in case chips are not communicating
   synchronize_ppu();
-  synchronize_smp();
+  if(smp.lockstep || smp.clock < -smp.sync_window) synchronize_smp();
   synchronize_coprocessor();
   system.scanline();
 
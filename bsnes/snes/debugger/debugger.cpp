@@ -200,27 +200,21 @@ bool Debugger::breakpoint_item_test(int i, Breakpoint::Source source, Breakpoint
   
   // account for address mirroring on the S-CPU and SA-1 (and other) buses
   // (with 64kb granularity for ranged breakpoints)
-  unsigned addr_start = (range_breakpoint[i].addr & 0xff0000) | (addr & 0xffff);
-  if (addr_start < range_breakpoint[i].addr) {
-    addr_start += 1<<16;
-  }
   unsigned addr_end = range_breakpoint[i].addr;
   if (range_breakpoint[i].addr_end > range_breakpoint[i].addr) {
     addr_end = range_breakpoint[i].addr_end;
   }
-  
-  for (; addr_start <= addr_end; addr_start += 1<<16) {
-    if (source == Debugger::Breakpoint::Source::CPUBus) {
-      if (bus.is_mirror(addr_start, addr)) break;
-    } else if (source == Debugger::Breakpoint::Source::SA1Bus) {
-      if (sa1bus.is_mirror(addr_start, addr)) break;
-    } else if (source == Debugger::Breakpoint::Source::SFXBus) {
-      if (superfxbus.is_mirror(addr_start, addr)) break;
-    } else {
-      if (addr_start == addr) break;
-    }
+
+  Bus *mirrors = 0;
+  if (source == Debugger::Breakpoint::Source::CPUBus) mirrors = &bus;
+  else if (source == Debugger::Breakpoint::Source::SA1Bus) mirrors = &sa1bus;
+  else if (source == Debugger::Breakpoint::Source::SFXBus) mirrors = &superfxbus;
+
+  if (mirrors) {
+    if (!mirrors->is_mirror(addr, range_breakpoint[i].addr, addr_end)) return false;
+  } else {
+    if (addr < range_breakpoint[i].addr || addr > addr_end) return false;
   }
-  if (addr_start > addr_end) return false;
 
   if (range_breakpoint[i].notify_only) {
     breakpoint_notify(source, addr, range_breakpoint[i].name);
@@ -312,8 +306,10 @@ uint8 Debugger::read(Debugger::MemorySource source, unsigned addr) {
     } break;
     
     case MemorySource::SGBBus: {
+      #if defined(DEBUGGER)
       if (cartridge.mode() == Cartridge::Mode::SuperGameBoy)
         return supergameboy.read_gb(addr & 0xffff);
+      #endif
     } break;
     
     case MemorySource::SGBROM: {
@@ -378,8 +374,10 @@ void Debugger::write(Debugger::MemorySource source, unsigned addr, uint8 data) {
     } break;
     
     case MemorySource::SGBBus: {
+      #if defined(DEBUGGER)
       if (cartridge.mode() == Cartridge::Mode::SuperGameBoy)
         supergameboy.write_gb(addr & 0xffff, data);
+      #endif
     } break;
     
     case MemorySource::SGBROM: {
@@ -46,9 +46,10 @@ void DSP::enter() {
   while(true) {
     scheduler.synchronize();
 #else
+  //runs as many phases (and whole samples) as the S-SMP is ahead by, in one call
   #define PHASE(n) case n:
-  #define TICK return tick()
-  switch(phase & 31) {
+  #define TICK tick(); if(clock >= 0) return
+  while(true) switch(phase & 31) {
 #endif
     PHASE(0)
     voice_5(voice[0]);
@@ -1,8 +1,15 @@
-#define DSP_THREADED true
+//dsp=batched builds (-DDSP_BATCHED) run the S-DSP on the S-SMP thread instead of
+//its own, and only catch it up before S-SMP bus accesses (see SMP::op_read())
+#if defined(DSP_BATCHED)
+  #define DSP_THREADED false
+#else
+  #define DSP_THREADED true
+#endif
 
 class DSP : public Processor {
 public:
   enum : bool { Threaded = DSP_THREADED };
+  enum : bool { Batched = !DSP_THREADED };
   enum : bool { SupportsChannelEnable = false };
 
   alwaysinline void step(unsigned clocks);
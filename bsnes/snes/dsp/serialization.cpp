@@ -1,6 +1,11 @@
 #ifdef DSP_CPP
 
 void DSP::serialize(serializer &s) {
+#if !DSP_THREADED
+  //the threaded S-DSP is never behind the S-SMP
+  if(clock < 0) enter();
+#endif
+
   Processor::serialize(s);
 
 #if !DSP_THREADED
@@ -38,7 +38,7 @@ unsigned snes_library_revision_major(void) {
 }
 
 unsigned snes_library_revision_minor(void) {
-  return 1;
+  return 2;
 }
 
 void snes_set_video_refresh(snes_video_refresh_t video_refresh) {
@@ -126,6 +126,23 @@ bool snes_load_cartridge_normal(
   return true;
 }
 
+bool snes_load_cartridge_normal_file(
+  const char *rom_xml, const char *rom_path
+) {
+  snes_cheat_reset();
+  if(SNES::memory::cartrom.map(rom_path) == false) return false;
+  if((SNES::memory::cartrom.size() & 0x7fff) == 512) {
+    SNES::memory::cartrom.reset();
+    return false;
+  }
+  const uint8_t *rom_data = SNES::memory::cartrom.data();
+  unsigned rom_size = SNES::memory::cartrom.size();
+  string xmlrom = (rom_xml && *rom_xml) ? string(rom_xml) : SNESCartridge(rom_data, rom_size).xmlMemoryMap;
+  SNES::cartridge.load(SNES::Cartridge::Mode::Normal, { xmlrom });
+  SNES::system.power();
+  return true;
+}
+
 bool snes_load_cartridge_bsx_slotted(
   const char *rom_xml, const uint8_t *rom_data, unsigned rom_size,
   const char *bsx_xml, const uint8_t *bsx_data, unsigned bsx_size
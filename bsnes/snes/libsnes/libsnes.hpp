@@ -93,6 +93,12 @@ bool snes_load_cartridge_normal(
   const char *rom_xml, const uint8_t *rom_data, unsigned rom_size
 );
 
+/* maps an uncompressed image file read-only rather than copying it into memory;
+ * fails if the file cannot be mapped or has a copier header. */
+bool snes_load_cartridge_normal_file(
+  const char *rom_xml, const char *rom_path
+);
+
 bool snes_load_cartridge_bsx_slotted(
   const char *rom_xml, const uint8_t *rom_data, unsigned rom_size,
   const char *bsx_xml, const uint8_t *bsx_data, unsigned bsx_size
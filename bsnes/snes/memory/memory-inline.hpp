@@ -1,6 +1,8 @@
 //Memory
 
 unsigned Memory::size() const { return 0; }
+uint8* Memory::direct_read(unsigned) { return 0; }
+uint8* Memory::direct_write(unsigned) { return 0; }
 
 bool Memory::debugger_access() {
 #if defined(DEBUGGER)
@@ -14,6 +16,8 @@ bool Memory::debugger_access() {
 
 uint8* StaticRAM::data() { return data_; }
 unsigned StaticRAM::size() const { return size_; }
+uint8* StaticRAM::direct_read(unsigned) { return data_; }
+uint8* StaticRAM::direct_write(unsigned) { return data_; }
 
 uint8 StaticRAM::read(unsigned addr) { return data_[addr]; }
 void StaticRAM::write(unsigned addr, uint8 n) { data_[addr] = n; }
@@ -26,7 +30,10 @@ StaticRAM::~StaticRAM() { delete[] data_; }
 //MappedRAM
 
 void MappedRAM::reset() {
-  if(data_) {
+  if(file_.opened()) {
+    file_.close();
+    data_ = 0;
+  } else if(data_) {
     delete[] data_;
     data_ = 0;
   }
@@ -40,6 +47,19 @@ void MappedRAM::map(uint8 *source, unsigned length) {
   size_ = data_ && length > 0 ? length : 0;
 }
 
+//maps a file read-only instead of copying it; the size is rounded up to a whole page,
+//which reads back as zero like the padding of copy(). allocated contents are only
+//released once the file is mapped
+bool MappedRAM::map(const char *filename) {
+  if(file_.opened()) reset();
+  if(file_.open(filename, filemap::mode::read) == false) return false;
+  if(data_) delete[] data_;
+  write_protect_ = false;
+  data_ = file_.data();
+  size_ = (file_.size() & ~255) + ((bool)(file_.size() & 255) << 8);
+  return true;
+}
+
 void MappedRAM::copy(const uint8 *data, unsigned size) {
   if(!data_) {
     size_ = (size & ~255) + ((bool)(size & 255) << 8);
@@ -51,9 +71,12 @@ void MappedRAM::copy(const uint8 *data, unsigned size) {
 void MappedRAM::write_protect(bool status) { write_protect_ = status; }
 uint8* MappedRAM::data() { return data_; }
 unsigned MappedRAM::size() const { return size_; }
+bool MappedRAM::mapped() const { return file_.opened(); }
+uint8* MappedRAM::direct_read(unsigned) { return data_; }
+uint8* MappedRAM::direct_write(unsigned) { return write_protect_ || file_.opened() ? 0 : data_; }
 
 uint8 MappedRAM::read(unsigned addr) { return data_[addr]; }
-void MappedRAM::write(unsigned addr, uint8 n) { if(!write_protect_ || debugger_access()) data_[addr] = n; }
+void MappedRAM::write(unsigned addr, uint8 n) { if((!write_protect_ || debugger_access()) && !file_.opened()) data_[addr] = n; }
 const uint8& MappedRAM::operator[](unsigned addr) const { return data_[addr]; }
 MappedRAM::MappedRAM() : data_(0), size_(0), write_protect_(false) {}
 
@@ -107,12 +130,14 @@ uint8 Bus::read(uint24 addr) {
   }
   #endif
   Page &p = page[addr >> 8];
+  if(p.read_data) return p.read_data[p.offset + addr];
   return p.access->read(p.offset + addr);
 }
 
 void Bus::write(uint24 addr, uint8 data) {
   Page &p = page[addr >> 8];
-  p.access->write(p.offset + addr, data);
+  if(p.write_data) p.write_data[p.offset + addr] = data;
+  else p.access->write(p.offset + addr, data);
 }
 
 bool Bus::is_mirror(uint24 addr1, uint24 addr2) {
@@ -120,7 +145,6 @@ bool Bus::is_mirror(uint24 addr1, uint24 addr2) {
   // since pages are always aligned to 256-byte boundaries
   if((addr1 ^ addr2) & 0xff) return false;
 
-  Page &p1 = page[addr1 >> 8];
-  Page &p2 = page[addr2 >> 8];
-  return (p1.access == p2.access) && (p1.offset + addr1 == p2.offset + addr2);
+  if(!mirrors_valid) map_mirrors();
+  return mirror_page[addr1 >> 8] == mirror_page[addr2 >> 8];
 }
@@ -27,12 +27,11 @@ uint8 UnmappedMMIO::mmio_read(unsigned) { return cpu.regs.mdr; }
 void UnmappedMMIO::mmio_write(unsigned, uint8) {}
 
 MMIO* MMIOAccess::handle(unsigned addr) {
-  return mmio[addr];
+  return mmio[addr].access;
 }
 
 void MMIOAccess::map(unsigned addr, MMIO &access) {
-  assert(addr >= Min && addr <= Max);
-  mmio[addr] = &access;
+  map(addr, access, 0, 0);
 }
 
 void MMIOAccess::map(unsigned addr_lo, unsigned addr_hi, MMIO &access) {
@@ -40,22 +39,38 @@ void MMIOAccess::map(unsigned addr_lo, unsigned addr_hi, MMIO &access) {
   assert(addr_lo >= Min && addr_lo <= Max);
   assert(addr_hi >= Min && addr_hi <= Max);
   for(unsigned addr = addr_lo; addr <= addr_hi; addr++) {
-    mmio[addr] = &access;
+    map(addr, access, 0, 0);
   }
 }
 
+void MMIOAccess::map(unsigned addr, MMIO &access, Reader reader, Writer writer) {
+  assert(addr >= Min && addr <= Max);
+  mmio[addr].access = &access;
+  mmio[addr].read = reader ? reader : &MMIOAccess::mmio_read;
+  mmio[addr].write = writer ? writer : &MMIOAccess::mmio_write;
+}
+
 unsigned MMIOAccess::size() const { return 0x8000; }
 
 uint8 MMIOAccess::read(unsigned addr) {
-  return mmio[addr]->mmio_read(addr);
+  Handler &h = mmio[addr];
+  return h.read(*h.access, addr);
 }
 
 void MMIOAccess::write(unsigned addr, uint8 data) {
-  if(!debugger_access()) mmio[addr]->mmio_write(addr, data);
+  Handler &h = mmio[addr];
+  if(!debugger_access()) h.write(*h.access, addr, data);
 }
 
+uint8 MMIOAccess::mmio_read(MMIO &access, unsigned addr) { return access.mmio_read(addr); }
+void MMIOAccess::mmio_write(MMIO &access, unsigned addr, uint8 data) { access.mmio_write(addr, data); }
+
 MMIOAccess::MMIOAccess() {
-  for(unsigned i = 0; i < 0x8000; i++) mmio[i] = &memory::mmio_unmapped;
+  for(unsigned i = 0; i < 0x8000; i++) {
+    mmio[i].access = &memory::mmio_unmapped;
+    mmio[i].read = &MMIOAccess::mmio_read;
+    mmio[i].write = &MMIOAccess::mmio_write;
+  }
 }
 
 unsigned Bus::mirror(unsigned addr, unsigned size) {
@@ -80,6 +95,61 @@ void Bus::map(unsigned addr, Memory &access, unsigned offset) {
   Page &p = page[addr >> 8];
   p.access = &access;
   p.offset = offset - addr;
+  p.read_data = access.direct_read(offset);
+  p.write_data = access.direct_write(offset);
+  mirrors_valid = false;
+}
+
+//numbers each page by the first page that maps the same memory at the same offset,
+//then collects the banks in which each page recurs at the same address within the bank
+void Bus::map_mirrors() {
+  std::map<std::pair<Memory*, unsigned>, unsigned> targets;
+  for(unsigned n = 0; n < 65536; n++) {
+    auto target = std::make_pair(page[n].access, page[n].offset + (n << 8));
+    mirror_page[n] = targets.insert(std::make_pair(target, n)).first->second;
+  }
+
+  std::map<unsigned, unsigned> groups;
+  mirror_banks.clear();
+  mirror_banks.push_back(BankSet());
+  for(unsigned n = 0; n < 65536; n++) {
+    mirror_bank[n] = 0;
+    auto group = groups.insert(std::make_pair(mirror_page[n] << 8 | (n & 0xff), n));
+    if(group.second) continue;
+
+    unsigned first = group.first->second;
+    if(mirror_bank[first] == 0) {
+      BankSet banks = {};
+      banks.bits[first >> 14] |= 1ull << (first >> 8 & 63);
+      mirror_bank[first] = mirror_banks.size();
+      mirror_banks.push_back(banks);
+    }
+    mirror_bank[n] = mirror_bank[first];
+    mirror_banks[mirror_bank[n]].bits[n >> 14] |= 1ull << (n >> 8 & 63);
+  }
+  mirrors_valid = true;
+}
+
+//true if addr, or a mirror of it at the same address within another bank, lies in [addr_lo, addr_hi]
+bool Bus::is_mirror(uint24 addr, uint24 addr_lo, uint24 addr_hi) {
+  if(!mirrors_valid) map_mirrors();
+
+  signed bank_lo = addr_lo >> 16, bank_hi = addr_hi >> 16;
+  if((uint16)addr < (uint16)addr_lo) bank_lo++;
+  if((uint16)addr > (uint16)addr_hi) bank_hi--;
+  if(bank_lo > bank_hi) return false;
+
+  unsigned index = mirror_bank[addr >> 8];
+  if(index == 0) return (signed)(addr >> 16) >= bank_lo && (signed)(addr >> 16) <= bank_hi;
+
+  const BankSet &banks = mirror_banks[index];
+  for(unsigned word = bank_lo >> 6; word <= (unsigned)bank_hi >> 6; word++) {
+    uint64 mask = ~0ull;
+    if(word == bank_lo >> 6) mask &= ~0ull << (bank_lo & 63);
+    if(word == bank_hi >> 6) mask &= ~0ull >> (63 - (bank_hi & 63));
+    if(banks.bits[word] & mask) return true;
+  }
+  return false;
 }
 
 void Bus::map(
@@ -144,6 +214,23 @@ bool Bus::load_cart() {
 void Bus::unload_cart() {
 }
 
+//the S-CPU access time depends only on the address, at page granularity;
+//rom_speed ($420d) applies to $[80-bf]:[8000-ffff] and $[c0-ff]:[0000-ffff]
+void Bus::map_speed(unsigned rom_speed) {
+  for(unsigned n = 0; n < 65536; n++) {
+    unsigned addr = n << 8;
+    if(addr & 0x408000) {
+      page[n].speed = addr & 0x800000 ? rom_speed : 8;
+    } else if((addr + 0x6000) & 0x4000) {
+      page[n].speed = 8;
+    } else if((addr - 0x4000) & 0x7e00) {
+      page[n].speed = 6;
+    } else {
+      page[n].speed = 12;
+    }
+  }
+}
+
 void Bus::map_reset() {
   map(MapMode::Direct, 0x00, 0xff, 0x0000, 0xffff, memory::memory_unmapped);
   map(MapMode::Shadow, 0x00, 0x3f, MMIOAccess::Min, MMIOAccess::Max, memory::mmio);
@@ -3,6 +3,12 @@ struct Memory {
   virtual uint8 read(unsigned addr) = 0;
   virtual void write(unsigned addr, uint8 data) = 0;
   static alwaysinline bool debugger_access();
+
+  //storage that read() / write() access verbatim, if any; the bus then bypasses them.
+  //sampled when a page is mapped, so changes (eg write_protect()) must precede Bus::map().
+  //offset is that of the mapped page, for memories where only some pages qualify
+  virtual inline uint8* direct_read(unsigned offset);
+  virtual inline uint8* direct_write(unsigned offset);
 };
 
 struct MMIO {
@@ -24,6 +30,8 @@ struct UnmappedMMIO : MMIO {
 struct StaticRAM : Memory {
   inline uint8* data();
   inline unsigned size() const;
+  inline uint8* direct_read(unsigned offset);
+  inline uint8* direct_write(unsigned offset);
 
   inline uint8 read(unsigned addr);
   inline void write(unsigned addr, uint8 n);
@@ -41,11 +49,15 @@ private:
 struct MappedRAM : Memory {
   inline void reset();
   inline void map(uint8*, unsigned);
+  inline bool map(const char *filename);
   inline void copy(const uint8*, unsigned);
 
   inline void write_protect(bool status);
   inline uint8* data();
   inline unsigned size() const;
+  inline bool mapped() const;
+  inline uint8* direct_read(unsigned offset);
+  inline uint8* direct_write(unsigned offset);
 
   inline uint8 read(unsigned addr);
   inline void write(unsigned addr, uint8 n);
@@ -56,6 +68,7 @@ private:
   uint8 *data_;
   unsigned size_;
   bool write_protect_;
+  filemap file_;  //read-only mapping backing data_, if any; never written, not even by the debugger
 };
 
 struct VRAM : MappedRAM {
@@ -75,9 +88,15 @@ private:
 struct MMIOAccess : Memory {
   enum : unsigned { Min = 0x2000, Max = 0x4fff };
 
+  //handlers of a single register, called with the MMIO they were mapped for;
+  //they spare a chip decoding the address again in mmio_read() / mmio_write()
+  typedef uint8 (*Reader)(MMIO&, unsigned addr);
+  typedef void (*Writer)(MMIO&, unsigned addr, uint8 data);
+
   MMIO* handle(unsigned addr);
   void map(unsigned addr, MMIO &access);
   void map(unsigned addr_lo, unsigned addr_hi, MMIO &access);
+  void map(unsigned addr, MMIO &access, Reader reader, Writer writer);  //null: mmio_read() / mmio_write()
 
   unsigned size() const;
   uint8 read(unsigned addr);
@@ -85,7 +104,14 @@ struct MMIOAccess : Memory {
   MMIOAccess();
 
 private:
-  MMIO *mmio[0x8000];
+  struct Handler {
+    MMIO *access;
+    Reader read;
+    Writer write;
+  } mmio[0x8000];
+
+  static uint8 mmio_read(MMIO &access, unsigned addr);
+  static void mmio_write(MMIO &access, unsigned addr, uint8 data);
 };
 
 struct Bus {
@@ -100,6 +126,8 @@ struct Bus {
   alwaysinline void write(uint24 addr, uint8 data);
 
   alwaysinline bool is_mirror(uint24 addr1, uint24 addr2);
+  bool is_mirror(uint24 addr, uint24 addr_lo, uint24 addr_hi);
+  void map_speed(unsigned rom_speed);
   
   bool load_cart();
   void unload_cart();
@@ -110,6 +138,9 @@ struct Bus {
   struct Page {
     Memory *access;
     unsigned offset;
+    unsigned speed;     //S-CPU clocks per access; set by map_speed()
+    uint8 *read_data;   //access->direct_read(), or null for MMIO and special chips
+    uint8 *write_data;  //access->direct_write(), or null
   } page[65536];
 
   void serialize(serializer&);
@@ -117,6 +148,15 @@ struct Bus {
 private:
   inline void map(unsigned addr, Memory &access, unsigned offset);
 
+  //mirror tables, rebuilt by map_mirrors() on first use after any map()
+  struct BankSet { uint64 bits[4]; };
+  bool mirrors_valid;
+  uint16 mirror_page[65536];  //lowest page mapped to the same memory and offset
+  uint16 mirror_bank[65536];  //index into mirror_banks of the banks holding a mirror at the same
+                              //page of the bank, or 0 if there are none
+  std::vector<BankSet> mirror_banks;
+  void map_mirrors();
+
   void map_reset();
   void map_xml();
   void map_system();
@@ -960,4 +960,33 @@ void PPU::mmio_write(unsigned addr, uint8 data) {
   }
 }
 
+//registers get handlers of their own, so accesses skip the switch above
+template<uint8 (PPU::*Read)()> uint8 PPU::mmio_reader(MMIO &access, unsigned) {
+  if(!Memory::debugger_access())
+    cpu.synchronize_ppu();
+  return (static_cast<PPU&>(access).*Read)();
+}
+
+template<void (PPU::*Write)(uint8)> void PPU::mmio_writer(MMIO &access, unsigned, uint8 data) {
+  cpu.synchronize_ppu();
+  (static_cast<PPU&>(access).*Write)(data);
+}
+
+void PPU::mmio_map() {
+  memory::mmio.map(0x2100, 0x213f, *this);
+
+  #define r(addr) memory::mmio.map(0x##addr, *this, &PPU::mmio_reader<&PPU::mmio_r##addr>, 0)
+  #define w(addr) memory::mmio.map(0x##addr, *this, 0, &PPU::mmio_writer<&PPU::mmio_w##addr>)
+  w(2100); w(2101); w(2102); w(2103); w(2104); w(2105); w(2106); w(2107); w(2108); w(2109);
+  w(210a); w(210b); w(210c); w(210d); w(210e); w(210f); w(2110); w(2111); w(2112); w(2113);
+  w(2114); w(2115); w(2116); w(2117); w(2118); w(2119); w(211a); w(211b); w(211c); w(211d);
+  w(211e); w(211f); w(2120); w(2121); w(2122); w(2123); w(2124); w(2125); w(2126); w(2127);
+  w(2128); w(2129); w(212a); w(212b); w(212c); w(212d); w(212e); w(212f); w(2130); w(2131);
+  w(2132); w(2133);
+  r(2134); r(2135); r(2136); r(2137); r(2138); r(2139); r(213a); r(213b); r(213c); r(213d);
+  r(213e); r(213f);
+  #undef w
+  #undef r
+}
+
 #endif
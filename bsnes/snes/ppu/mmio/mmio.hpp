@@ -167,3 +167,5 @@ uint8 mmio_r213f();  //STAT78
 void mmio_reset();
 uint8 mmio_read(unsigned addr);
 void mmio_write(unsigned addr, uint8 data);
+template<uint8 (PPU::*Read)()> static uint8 mmio_reader(MMIO&, unsigned);
+template<void (PPU::*Write)(uint8)> static void mmio_writer(MMIO&, unsigned, uint8);
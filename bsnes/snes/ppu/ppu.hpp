@@ -14,6 +14,7 @@ public:
   bool hires() const;
 
   void enter();
+  void mmio_map();
   void power();
   void reset();
 
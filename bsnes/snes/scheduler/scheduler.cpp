@@ -4,18 +4,24 @@ Scheduler scheduler;
 
 void Scheduler::enter() {
   host_thread = co_active();
+  if(profiling) profile_switch(thread);
   co_switch(thread);
 }
 
 void Scheduler::exit(ExitReason reason) {
   exit_reason = reason;
   thread = co_active();
+  if(profiling) {
+    profile_switch(host_thread);
+    if(reason == ExitReason::FrameEvent) profile_frame();
+  }
   co_switch(host_thread);
 }
 
 void Scheduler::resume(cothread_t& thread) {
   if (mode == Mode::Synchronize)
     desynchronized = true;
+  if(profiling) profile_switch(thread);
   co_switch(thread);
 }
 
@@ -24,6 +30,171 @@ void Scheduler::init() {
   thread = cpu.thread;
   desynchronized = false;
   mode = Mode::Synchronize;
+  #if defined(SCHEDULER_QUEUE)
+  coprocessor_queue.reset();
+  #endif
+}
+
+//coprocessor queue
+
+//resume every coprocessor that has fallen behind the S-CPU
+void CoprocessorQueue::synchronize() {
+  unsigned ticks = time - ticked;
+  ticked = time;
+  queue.tick(ticks);
+}
+
+//apply S-CPU time elapsed since the last update to the coprocessor clock
+void CoprocessorQueue::update(unsigned id) {
+  Processor &chip = *cpu.coprocessors[id];
+  chip.clock -= (time - synced[id]) * (uint64)chip.frequency;
+  synced[id] = time;
+}
+
+void CoprocessorQueue::update() {
+  for(unsigned id = 0; id < cpu.coprocessors.size(); id++) update(id);
+}
+
+//schedule the coprocessor for the first S-CPU clock at which it is behind
+void CoprocessorQueue::enqueue(unsigned id, unsigned minimum) {
+  Processor &chip = *cpu.coprocessors[id];
+  unsigned counter = minimum;
+  if(chip.clock >= 0) counter = min((uint64)chip.clock / chip.frequency + 1, (uint64)1 << 30);
+  queue.enqueue(max(counter, minimum) + (time - ticked), id);
+}
+
+void CoprocessorQueue::resume(unsigned id) {
+  update(id);
+  cpu.coprocessors[id]->synchronize();
+  //a coprocessor still behind here has yielded early; retry at the next synchronization
+  enqueue(id, 1);
+}
+
+//rebuild the queue after the coprocessor list or clocks have changed outside of it
+void CoprocessorQueue::reset() {
+  queue.reset();
+  ticked = time;
+  for(unsigned id = 0; id < cpu.coprocessors.size(); id++) {
+    synced[id] = time;
+    enqueue(id, 0);
+  }
+}
+
+CoprocessorQueue::CoprocessorQueue() : queue(Capacity, { &CoprocessorQueue::resume, this }) {
+  time = 0;
+  ticked = 0;
+  memset(synced, 0, sizeof synced);
+}
+
+//profiling
+
+static uint64 profile_time() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()
+  ).count();
+}
+
+uint64 Scheduler::Statistics::switch_count(Thread source, Thread destination) const {
+  return switches[(unsigned)source][(unsigned)destination];
+}
+
+uint64 Scheduler::Statistics::switch_count() const {
+  uint64 count = 0;
+  for(unsigned s = 0; s < ThreadCount; s++) {
+    for(unsigned d = 0; d < ThreadCount; d++) count += switches[s][d];
+  }
+  return count;
+}
+
+void Scheduler::Statistics::accumulate(const Statistics &source) {
+  for(unsigned s = 0; s < ThreadCount; s++) {
+    for(unsigned d = 0; d < ThreadCount; d++) switches[s][d] += source.switches[s][d];
+    time[s] += source.time[s];
+  }
+  frames += source.frames;
+}
+
+void Scheduler::Statistics::reset() {
+  memset(switches, 0, sizeof switches);
+  memset(time, 0, sizeof time);
+  frames = 0;
+}
+
+void Scheduler::profile(bool enable) {
+  statistics.reset();
+  frame_statistics.reset();
+  frame_profile.reset();
+  profile_thread = thread_id(co_active());
+  profile_timestamp = profile_time();
+  profiling = enable;
+}
+
+Scheduler::Thread Scheduler::thread_id(cothread_t handle) const {
+  if(handle == host_thread) return Thread::Host;
+  if(handle == cpu.thread) return Thread::CPU;
+  if(handle == smp.thread) return Thread::SMP;
+  if(handle == dsp.thread) return Thread::DSP;
+  if(handle == ppu.thread) return Thread::PPU;
+  return Thread::Coprocessor;
+}
+
+void Scheduler::profile_switch(cothread_t destination) {
+  uint64 timestamp = profile_time();
+  Thread target = thread_id(destination);
+  frame_profile.time[(unsigned)profile_thread] += timestamp - profile_timestamp;
+  frame_profile.switches[(unsigned)profile_thread][(unsigned)target]++;
+  profile_thread = target;
+  profile_timestamp = timestamp;
+}
+
+void Scheduler::profile_frame() {
+  frame_profile.frames = 1;
+  frame_statistics = frame_profile;
+  statistics.accumulate(frame_profile);
+  frame_profile.reset();
+}
+
+bool Scheduler::property(unsigned id, string &name, string &value) {
+  unsigned n = 0;
+
+  #define item(name_, value_) \
+  if(id == n++) { \
+    name = name_; \
+    value = value_; \
+    return true; \
+  }
+
+  #define switches(source, destination) \
+  (unsigned)frame_statistics.switch_count(Thread::source, Thread::destination)
+
+  #define microseconds(thread) \
+  string((unsigned)(frame_statistics.time[(unsigned)Thread::thread] / 1000), " us")
+
+  item("Profiling", profiling());
+  item("Frames Profiled", statistics.frames);
+
+  item("Context Switches (last frame)", "");
+  item("Total", (unsigned)frame_statistics.switch_count());
+  item("S-CPU -> S-SMP", switches(CPU, SMP));
+  item("S-SMP -> S-CPU", switches(SMP, CPU));
+  item("S-SMP -> S-DSP", switches(SMP, DSP));
+  item("S-DSP -> S-SMP", switches(DSP, SMP));
+  item("S-CPU -> S-PPU", switches(CPU, PPU));
+  item("S-PPU -> S-CPU", switches(PPU, CPU));
+  item("S-CPU -> Coprocessor", switches(CPU, Coprocessor));
+  item("Coprocessor -> S-CPU", switches(Coprocessor, CPU));
+
+  item("Host Time (last frame)", "");
+  item("S-CPU", microseconds(CPU));
+  item("S-SMP", microseconds(SMP));
+  item("S-DSP", microseconds(DSP));
+  item("S-PPU", microseconds(PPU));
+  item("Coprocessor", microseconds(Coprocessor));
+
+  #undef microseconds
+  #undef switches
+  #undef item
+  return false;
 }
 
 Scheduler::Scheduler() {
@@ -31,6 +202,13 @@ Scheduler::Scheduler() {
   thread = 0;
   desynchronized = false;
   exit_reason = ExitReason::UnknownEvent;
+
+  profiling = false;
+  statistics.reset();
+  frame_statistics.reset();
+  frame_profile.reset();
+  profile_thread = Thread::Host;
+  profile_timestamp = 0;
 }
 
 #endif
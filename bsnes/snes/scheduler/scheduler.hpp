@@ -1,4 +1,28 @@
-struct Scheduler : property<Scheduler> {
+//priority queue coprocessor scheduling (make scheduler=queue, -DSCHEDULER_QUEUE):
+//instead of CPU::step() decrementing every coprocessor clock, only the S-CPU time
+//advances. a coprocessor clock is brought up to date when it is resumed, and a
+//min-heap keyed by the S-CPU time at which each coprocessor falls behind lets
+//CPU::synchronize_coprocessor() return at once when none of them has.
+struct CoprocessorQueue {
+  alwaysinline void step(unsigned clocks) { time += clocks; }
+  void synchronize();
+  void update();
+  void reset();
+  CoprocessorQueue();
+
+private:
+  enum : unsigned { Capacity = 16 };
+  priority_queue<unsigned> queue;
+  unsigned time;              //S-CPU clocks elapsed (modulo 2^32)
+  unsigned ticked;            //time the queue has been advanced to
+  unsigned synced[Capacity];  //time each coprocessor clock was last brought up to date
+
+  void resume(unsigned id);
+  void update(unsigned id);
+  void enqueue(unsigned id, unsigned minimum);
+};
+
+struct Scheduler : property<Scheduler>, ChipDebugger {
   enum class Mode : unsigned { Run, Synchronize } mode;
   enum class ExitReason : unsigned { UnknownEvent, FrameEvent, SynchronizeEvent, DesynchronizeEvent, DebuggerEvent };
   readonly<ExitReason> exit_reason;
@@ -24,8 +48,43 @@ struct Scheduler : property<Scheduler> {
   }
   inline void desynchronize() { desynchronized = true; }
 
+  CoprocessorQueue coprocessor_queue;
+
+  //optional instrumentation:
+  //counts co_switch() calls per source/destination thread pair,
+  //and accumulates host time spent inside each thread
+  enum class Thread : unsigned { Host, CPU, SMP, DSP, PPU, Coprocessor };
+  enum : unsigned { ThreadCount = 6 };
+
+  struct Statistics {
+    uint64 switches[ThreadCount][ThreadCount];  //[source][destination]
+    uint64 time[ThreadCount];                   //host time, in nanoseconds
+    unsigned frames;
+
+    uint64 switch_count(Thread source, Thread destination) const;
+    uint64 switch_count() const;
+    void accumulate(const Statistics&);
+    void reset();
+  };
+
+  readonly<bool> profiling;
+  Statistics statistics;        //totals since profiling was last enabled
+  Statistics frame_statistics;  //most recently completed frame
+
+  void profile(bool enable);
+  bool property(unsigned id, string &name, string &value);
+
   void init();
   Scheduler();
+
+private:
+  Statistics frame_profile;
+  Thread profile_thread;
+  uint64 profile_timestamp;
+
+  Thread thread_id(cothread_t) const;
+  void profile_switch(cothread_t destination);
+  void profile_frame();
 };
 
 extern Scheduler scheduler;
@@ -113,6 +113,14 @@ public:
   void (SMPcore::*opcode_table[256])();
   void initialize_opcode_table();
 
+  //executes one opcode; builds with cpucore=switch dispatch through a switch
+  //statement rather than a pointer-to-member call
+  #if defined(SMPCORE_SWITCH)
+  void op_exec(uint8 opcode);
+  #else
+  alwaysinline void op_exec(uint8 opcode) { (this->*opcode_table[opcode])(); }
+  #endif
+
   void core_serialize(serializer&);
   SMPcore();
 };
@@ -0,0 +1,259 @@
+//one entry per opcode, expanded by the op() macro in table.cpp
+//(as opcode_table entries, or as cases of the switch dispatcher)
+
+op(0x00, op_nop)
+op(0x01, op_tcall<0>)
+op(0x02, op_setbit_dp<1, 0x01>)
+op(0x03, op_bitbranch<0x01, true>)
+op(0x04, op_read_reg_dp<&SMPcore::op_or, A>)
+op(0x05, op_read_reg_addr<&SMPcore::op_or, A>)
+op(0x06, op_read_a_ix<&SMPcore::op_or>)
+op(0x07, op_read_a_idpx<&SMPcore::op_or>)
+op(0x08, op_read_reg_const<&SMPcore::op_or, A>)
+op(0x09, op_read_dp_dp<&SMPcore::op_or>)
+op(0x0a, op_or1_bit<0>)
+op(0x0b, op_adjust_dp<&SMPcore::op_asl>)
+op(0x0c, op_adjust_addr<&SMPcore::op_asl>)
+op(0x0d, op_push_p)
+op(0x0e, op_adjust_addr_a<1>)
+op(0x0f, op_brk)
+op(0x10, op_branch<0x80, false>)
+op(0x11, op_tcall<1>)
+op(0x12, op_setbit_dp<0, 0x01>)
+op(0x13, op_bitbranch<0x01, false>)
+op(0x14, op_read_a_dpx<&SMPcore::op_or>)
+op(0x15, op_read_a_addrr<&SMPcore::op_or, X>)
+op(0x16, op_read_a_addrr<&SMPcore::op_or, Y>)
+op(0x17, op_read_a_idpy<&SMPcore::op_or>)
+op(0x18, op_read_dp_const<&SMPcore::op_or>)
+op(0x19, op_read_ix_iy<&SMPcore::op_or>)
+op(0x1a, op_adjustw_dp<-1>)
+op(0x1b, op_adjust_dpx<&SMPcore::op_asl>)
+op(0x1c, op_adjust_reg<&SMPcore::op_asl, A>)
+op(0x1d, op_adjust_reg<&SMPcore::op_dec, X>)
+op(0x1e, op_read_reg_addr<&SMPcore::op_cmp, X>)
+op(0x1f, op_jmp_iaddrx)
+op(0x20, op_setbit<0x20, 0x00>)
+op(0x21, op_tcall<2>)
+op(0x22, op_setbit_dp<1, 0x02>)
+op(0x23, op_bitbranch<0x02, true>)
+op(0x24, op_read_reg_dp<&SMPcore::op_and, A>)
+op(0x25, op_read_reg_addr<&SMPcore::op_and, A>)
+op(0x26, op_read_a_ix<&SMPcore::op_and>)
+op(0x27, op_read_a_idpx<&SMPcore::op_and>)
+op(0x28, op_read_reg_const<&SMPcore::op_and, A>)
+op(0x29, op_read_dp_dp<&SMPcore::op_and>)
+op(0x2a, op_or1_bit<1>)
+op(0x2b, op_adjust_dp<&SMPcore::op_rol>)
+op(0x2c, op_adjust_addr<&SMPcore::op_rol>)
+op(0x2d, op_push_reg<A>)
+op(0x2e, op_cbne_dp)
+op(0x2f, op_bra)
+op(0x30, op_branch<0x80, true>)
+op(0x31, op_tcall<3>)
+op(0x32, op_setbit_dp<0, 0x02>)
+op(0x33, op_bitbranch<0x02, false>)
+op(0x34, op_read_a_dpx<&SMPcore::op_and>)
+op(0x35, op_read_a_addrr<&SMPcore::op_and, X>)
+op(0x36, op_read_a_addrr<&SMPcore::op_and, Y>)
+op(0x37, op_read_a_idpy<&SMPcore::op_and>)
+op(0x38, op_read_dp_const<&SMPcore::op_and>)
+op(0x39, op_read_ix_iy<&SMPcore::op_and>)
+op(0x3a, op_adjustw_dp<+1>)
+op(0x3b, op_adjust_dpx<&SMPcore::op_rol>)
+op(0x3c, op_adjust_reg<&SMPcore::op_rol, A>)
+op(0x3d, op_adjust_reg<&SMPcore::op_inc, X>)
+op(0x3e, op_read_reg_dp<&SMPcore::op_cmp, X>)
+op(0x3f, op_call)
+op(0x40, op_setbit<0x20, 0x20>)
+op(0x41, op_tcall<4>)
+op(0x42, op_setbit_dp<1, 0x04>)
+op(0x43, op_bitbranch<0x04, true>)
+op(0x44, op_read_reg_dp<&SMPcore::op_eor, A>)
+op(0x45, op_read_reg_addr<&SMPcore::op_eor, A>)
+op(0x46, op_read_a_ix<&SMPcore::op_eor>)
+op(0x47, op_read_a_idpx<&SMPcore::op_eor>)
+op(0x48, op_read_reg_const<&SMPcore::op_eor, A>)
+op(0x49, op_read_dp_dp<&SMPcore::op_eor>)
+op(0x4a, op_and1_bit<0>)
+op(0x4b, op_adjust_dp<&SMPcore::op_lsr>)
+op(0x4c, op_adjust_addr<&SMPcore::op_lsr>)
+op(0x4d, op_push_reg<X>)
+op(0x4e, op_adjust_addr_a<0>)
+op(0x4f, op_pcall)
+op(0x50, op_branch<0x40, false>)
+op(0x51, op_tcall<5>)
+op(0x52, op_setbit_dp<0, 0x04>)
+op(0x53, op_bitbranch<0x04, false>)
+op(0x54, op_read_a_dpx<&SMPcore::op_eor>)
+op(0x55, op_read_a_addrr<&SMPcore::op_eor, X>)
+op(0x56, op_read_a_addrr<&SMPcore::op_eor, Y>)
+op(0x57, op_read_a_idpy<&SMPcore::op_eor>)
+op(0x58, op_read_dp_const<&SMPcore::op_eor>)
+op(0x59, op_read_ix_iy<&SMPcore::op_eor>)
+op(0x5a, op_cmpw_ya_dp)
+op(0x5b, op_adjust_dpx<&SMPcore::op_lsr>)
+op(0x5c, op_adjust_reg<&SMPcore::op_lsr, A>)
+op(0x5d, op_mov_reg_reg<X, A>)
+op(0x5e, op_read_reg_addr<&SMPcore::op_cmp, Y>)
+op(0x5f, op_jmp_addr)
+op(0x60, op_setbit<0x01, 0x00>)
+op(0x61, op_tcall<6>)
+op(0x62, op_setbit_dp<1, 0x08>)
+op(0x63, op_bitbranch<0x08, true>)
+op(0x64, op_read_reg_dp<&SMPcore::op_cmp, A>)
+op(0x65, op_read_reg_addr<&SMPcore::op_cmp, A>)
+op(0x66, op_read_a_ix<&SMPcore::op_cmp>)
+op(0x67, op_read_a_idpx<&SMPcore::op_cmp>)
+op(0x68, op_read_reg_const<&SMPcore::op_cmp, A>)
+op(0x69, op_read_dp_dp<&SMPcore::op_cmp>)
+op(0x6a, op_and1_bit<1>)
+op(0x6b, op_adjust_dp<&SMPcore::op_ror>)
+op(0x6c, op_adjust_addr<&SMPcore::op_ror>)
+op(0x6d, op_push_reg<Y>)
+op(0x6e, op_dbnz_dp)
+op(0x6f, op_ret)
+op(0x70, op_branch<0x40, true>)
+op(0x71, op_tcall<7>)
+op(0x72, op_setbit_dp<0, 0x08>)
+op(0x73, op_bitbranch<0x08, false>)
+op(0x74, op_read_a_dpx<&SMPcore::op_cmp>)
+op(0x75, op_read_a_addrr<&SMPcore::op_cmp, X>)
+op(0x76, op_read_a_addrr<&SMPcore::op_cmp, Y>)
+op(0x77, op_read_a_idpy<&SMPcore::op_cmp>)
+op(0x78, op_read_dp_const<&SMPcore::op_cmp>)
+op(0x79, op_read_ix_iy<&SMPcore::op_cmp>)
+op(0x7a, op_read_ya_dp<&SMPcore::op_addw>)
+op(0x7b, op_adjust_dpx<&SMPcore::op_ror>)
+op(0x7c, op_adjust_reg<&SMPcore::op_ror, A>)
+op(0x7d, op_mov_reg_reg<A, X>)
+op(0x7e, op_read_reg_dp<&SMPcore::op_cmp, Y>)
+op(0x7f, op_reti)
+op(0x80, op_setbit<0x01, 0x01>)
+op(0x81, op_tcall<8>)
+op(0x82, op_setbit_dp<1, 0x10>)
+op(0x83, op_bitbranch<0x10, true>)
+op(0x84, op_read_reg_dp<&SMPcore::op_adc, A>)
+op(0x85, op_read_reg_addr<&SMPcore::op_adc, A>)
+op(0x86, op_read_a_ix<&SMPcore::op_adc>)
+op(0x87, op_read_a_idpx<&SMPcore::op_adc>)
+op(0x88, op_read_reg_const<&SMPcore::op_adc, A>)
+op(0x89, op_read_dp_dp<&SMPcore::op_adc>)
+op(0x8a, op_eor1_bit)
+op(0x8b, op_adjust_dp<&SMPcore::op_dec>)
+op(0x8c, op_adjust_addr<&SMPcore::op_dec>)
+op(0x8d, op_mov_reg_const<Y>)
+op(0x8e, op_pop_p)
+op(0x8f, op_mov_dp_const)
+op(0x90, op_branch<0x01, false>)
+op(0x91, op_tcall<9>)
+op(0x92, op_setbit_dp<0, 0x10>)
+op(0x93, op_bitbranch<0x10, false>)
+op(0x94, op_read_a_dpx<&SMPcore::op_adc>)
+op(0x95, op_read_a_addrr<&SMPcore::op_adc, X>)
+op(0x96, op_read_a_addrr<&SMPcore::op_adc, Y>)
+op(0x97, op_read_a_idpy<&SMPcore::op_adc>)
+op(0x98, op_read_dp_const<&SMPcore::op_adc>)
+op(0x99, op_read_ix_iy<&SMPcore::op_adc>)
+op(0x9a, op_read_ya_dp<&SMPcore::op_subw>)
+op(0x9b, op_adjust_dpx<&SMPcore::op_dec>)
+op(0x9c, op_adjust_reg<&SMPcore::op_dec, A>)
+op(0x9d, op_mov_reg_reg<X, SP>)
+op(0x9e, op_div_ya_x)
+op(0x9f, op_xcn)
+op(0xa0, op_seti<1>)
+op(0xa1, op_tcall<10>)
+op(0xa2, op_setbit_dp<1, 0x20>)
+op(0xa3, op_bitbranch<0x20, true>)
+op(0xa4, op_read_reg_dp<&SMPcore::op_sbc, A>)
+op(0xa5, op_read_reg_addr<&SMPcore::op_sbc, A>)
+op(0xa6, op_read_a_ix<&SMPcore::op_sbc>)
+op(0xa7, op_read_a_idpx<&SMPcore::op_sbc>)
+op(0xa8, op_read_reg_const<&SMPcore::op_sbc, A>)
+op(0xa9, op_read_dp_dp<&SMPcore::op_sbc>)
+op(0xaa, op_mov1_c_bit)
+op(0xab, op_adjust_dp<&SMPcore::op_inc>)
+op(0xac, op_adjust_addr<&SMPcore::op_inc>)
+op(0xad, op_read_reg_const<&SMPcore::op_cmp, Y>)
+op(0xae, op_pop_reg<A>)
+op(0xaf, op_mov_ixinc_a)
+op(0xb0, op_branch<0x01, true>)
+op(0xb1, op_tcall<11>)
+op(0xb2, op_setbit_dp<0, 0x20>)
+op(0xb3, op_bitbranch<0x20, false>)
+op(0xb4, op_read_a_dpx<&SMPcore::op_sbc>)
+op(0xb5, op_read_a_addrr<&SMPcore::op_sbc, X>)
+op(0xb6, op_read_a_addrr<&SMPcore::op_sbc, Y>)
+op(0xb7, op_read_a_idpy<&SMPcore::op_sbc>)
+op(0xb8, op_read_dp_const<&SMPcore::op_sbc>)
+op(0xb9, op_read_ix_iy<&SMPcore::op_sbc>)
+op(0xba, op_movw_ya_dp)
+op(0xbb, op_adjust_dpx<&SMPcore::op_inc>)
+op(0xbc, op_adjust_reg<&SMPcore::op_inc, A>)
+op(0xbd, op_mov_sp_x)
+op(0xbe, op_das)
+op(0xbf, op_mov_a_ixinc)
+op(0xc0, op_seti<0>)
+op(0xc1, op_tcall<12>)
+op(0xc2, op_setbit_dp<1, 0x40>)
+op(0xc3, op_bitbranch<0x40, true>)
+op(0xc4, op_mov_dp_reg<A>)
+op(0xc5, op_mov_addr_reg<A>)
+op(0xc6, op_mov_ix_a)
+op(0xc7, op_mov_idpx_a)
+op(0xc8, op_read_reg_const<&SMPcore::op_cmp, X>)
+op(0xc9, op_mov_addr_reg<X>)
+op(0xca, op_mov1_bit_c)
+op(0xcb, op_mov_dp_reg<Y>)
+op(0xcc, op_mov_addr_reg<Y>)
+op(0xcd, op_mov_reg_const<X>)
+op(0xce, op_pop_reg<X>)
+op(0xcf, op_mul_ya)
+op(0xd0, op_branch<0x02, false>)
+op(0xd1, op_tcall<13>)
+op(0xd2, op_setbit_dp<0, 0x40>)
+op(0xd3, op_bitbranch<0x40, false>)
+op(0xd4, op_mov_dpr_reg<A, X>)
+op(0xd5, op_mov_addrr_a<X>)
+op(0xd6, op_mov_addrr_a<Y>)
+op(0xd7, op_mov_idpy_a)
+op(0xd8, op_mov_dp_reg<X>)
+op(0xd9, op_mov_dpr_reg<X, Y>)
+op(0xda, op_movw_dp_ya)
+op(0xdb, op_mov_dpr_reg<Y, X>)
+op(0xdc, op_adjust_reg<&SMPcore::op_dec, Y>)
+op(0xdd, op_mov_reg_reg<A, Y>)
+op(0xde, op_cbne_dpx)
+op(0xdf, op_daa)
+op(0xe0, op_setbit<0x48, 0x00>)
+op(0xe1, op_tcall<14>)
+op(0xe2, op_setbit_dp<1, 0x80>)
+op(0xe3, op_bitbranch<0x80, true>)
+op(0xe4, op_mov_reg_dp<A>)
+op(0xe5, op_mov_reg_addr<A>)
+op(0xe6, op_mov_a_ix)
+op(0xe7, op_mov_a_idpx)
+op(0xe8, op_mov_reg_const<A>)
+op(0xe9, op_mov_reg_addr<X>)
+op(0xea, op_not1_bit)
+op(0xeb, op_mov_reg_dp<Y>)
+op(0xec, op_mov_reg_addr<Y>)
+op(0xed, op_notc)
+op(0xee, op_pop_reg<Y>)
+op(0xef, op_wait)
+op(0xf0, op_branch<0x02, true>)
+op(0xf1, op_tcall<15>)
+op(0xf2, op_setbit_dp<0, 0x80>)
+op(0xf3, op_bitbranch<0x80, false>)
+op(0xf4, op_mov_reg_dpr<A, X>)
+op(0xf5, op_mov_a_addrr<X>)
+op(0xf6, op_mov_a_addrr<Y>)
+op(0xf7, op_mov_a_idpy)
+op(0xf8, op_mov_reg_dp<X>)
+op(0xf9, op_mov_reg_dpr<X, Y>)
+op(0xfa, op_mov_dp_dp)
+op(0xfb, op_mov_reg_dpr<Y, X>)
+op(0xfc, op_adjust_reg<&SMPcore::op_inc, Y>)
+op(0xfd, op_mov_reg_reg<Y, A>)
+op(0xfe, op_dbnz_y)
+op(0xff, op_wait)
@@ -36,7 +36,7 @@ void SMPDebugger::op_step() {
   }
   
   SMP::op_step();
-  synchronize_cpu();
+  if(debugger.step_cpu) synchronize_cpu();
 }
 
 alwaysinline uint8_t SMPDebugger::op_readpc() {
@@ -138,6 +138,7 @@ bool SMPDebugger::property(unsigned id, string &name, string &value) {
   
   //$00fd-$00ff
   item("$00fd-$00ff", "");
+  sync_timers();
   item("Timer 0 Count", (unsigned)t0.stage3_ticks);
   item("Timer 1 Count", (unsigned)t1.stage3_ticks);
   item("Timer 2 Count", (unsigned)t2.stage3_ticks);
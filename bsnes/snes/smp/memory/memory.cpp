@@ -59,18 +59,21 @@ alwaysinline uint8 SMP::op_busread(uint16 addr) {
       } break;
 
       case 0xfd: {  //T0OUT -- 4-bit counter value
+        sync_timers();
         r = t0.stage3_ticks & 15;
         if (!Memory::debugger_access())
           t0.stage3_ticks = 0;
       } break;
 
       case 0xfe: {  //T1OUT -- 4-bit counter value
+        sync_timers();
         r = t1.stage3_ticks & 15;
         if (!Memory::debugger_access())
           t1.stage3_ticks = 0;
       } break;
 
       case 0xff: {  //T2OUT -- 4-bit counter value
+        sync_timers();
         r = t2.stage3_ticks & 15;
         if (!Memory::debugger_access())
           t2.stage3_ticks = 0;
@@ -88,6 +91,7 @@ alwaysinline void SMP::op_buswrite(uint16 addr, uint8 data) {
     switch(addr) {
       case 0xf0: {  //TEST
         if(regs.p.p) break;  //writes only valid when P flag is clear
+        sync_timers();
 
         status.internal_speed  = (data >> 6) & 3;
         status.external_speed  = (data >> 4) & 3;
@@ -102,6 +106,7 @@ alwaysinline void SMP::op_buswrite(uint16 addr, uint8 data) {
       } break;
 
       case 0xf1: {  //CONTROL
+        sync_timers();
         status.iplrom_enabled = data & 0x80;
 
         if(data & 0x30) {
@@ -167,14 +172,17 @@ alwaysinline void SMP::op_buswrite(uint16 addr, uint8 data) {
       } break;
 
       case 0xfa: {  //T0TARGET
+        sync_timers();
         t0.target = data;
       } break;
 
       case 0xfb: {  //T1TARGET
+        sync_timers();
         t1.target = data;
       } break;
 
       case 0xfc: {  //T2TARGET
+        sync_timers();
         t2.target = data;
       } break;
 
@@ -193,20 +201,44 @@ void SMP::op_io() {
   wait(0x00f0); // idle cycles use same timing as I/O registers
 }
 
+//RAM outside $00f0-$00ff and $ffc0-$ffff can reach neither the I/O registers nor
+//the IPL ROM, and always uses the external wait states; most accesses (all of the
+//stack, and direct page below $f0) can skip the checks below
+alwaysinline bool SMP::ram_only(uint16 addr) const {
+  return (addr & 0xfff0) != 0x00f0 && addr < 0xffc0;
+}
+
 uint8 SMP::op_read(uint16 addr) {
+  if(ram_only(addr)) {
+    wait_ram();
+    if(DSP::Batched) synchronize_dsp();
+    if(status.ram_disabled) return 0x5a;
+    return memory::apuram[addr];
+  }
+
   if((addr & 0xfffc) == 0xf4) {
     wait(addr, 1);
+    if(DSP::Batched) synchronize_dsp();
     uint8 data = op_busread(addr);
     wait(addr, 1);
     return data;
   } else {
     wait(addr);
+    if(DSP::Batched) synchronize_dsp();
 	return op_busread(addr);
   }
 }
 
 void SMP::op_write(uint16 addr, uint8 data) {
+  if(ram_only(addr)) {
+    wait_ram();
+    if(DSP::Batched) synchronize_dsp();
+    if(status.ram_writable && !status.ram_disabled) memory::apuram[addr] = data;
+    return;
+  }
+
   wait(addr);
+  if(DSP::Batched) synchronize_dsp();
   op_buswrite(addr, data);
 }
 
@@ -2,6 +2,7 @@ public:
 uint8 op_debugread(uint16 addr);
 
 private:
+bool ram_only(uint16 addr) const;
 uint8 ram_read(uint16 addr);
 void ram_write(uint16 addr, uint8 data);
 
@@ -1,6 +1,7 @@
 #ifdef SMP_CPP
 
 void SMP::serialize(serializer &s) {
+  sync_timers();
   Processor::serialize(s);
   SMPcore::core_serialize(s);
 
@@ -50,7 +50,8 @@ void SMP::op_step() {
   if(regs.wait)
     op_wait();
   else
-    (this->*opcode_table[op_readpc()])();
+    op_exec(op_readpc());
+  if(lockstep) synchronize_cpu();
 }
 
 void SMP::power() {
@@ -65,6 +66,9 @@ void SMP::power() {
 void SMP::reset() {
   create(Enter, system.apu_frequency());
 
+  lockstep = config().smp.sync_window == 0;
+  sync_window = lockstep ? 768 * 24 * (int64)24000000 : 768 * (int64)config().smp.sync_window * system.cpu_frequency();
+
   regs.pc = 0xffc0;
   regs.a = 0x00;
   regs.x = 0x00;
@@ -102,6 +106,7 @@ void SMP::reset() {
     port.aux[i] = 0;
   }
 
+  timer_clocks = 0;
   t0.stage0_ticks = 0;
   t1.stage0_ticks = 0;
   t2.stage0_ticks = 0;
@@ -152,6 +157,7 @@ void SMP::load_dump(uint8 *dump, uint16_t pc, uint8_t r[4], uint8_t p) {
   port.cpu_to_smp[2] = dump[0xF6];
   port.cpu_to_smp[3] = dump[0xF7];
   
+  sync_timers();
   t0.stage3_ticks = dump[0xFD] & 15;
   t1.stage3_ticks = dump[0xFE] & 15;
   t2.stage3_ticks = dump[0xFF] & 15;
@@ -215,6 +221,7 @@ void SMP::save_spc_dump() {
   out.write(memory::apuram[0xFB]);
   out.write(memory::apuram[0xFC]);
   
+  sync_timers();
   out.write(t0.stage3_ticks & 15);
   out.write(t1.stage3_ticks & 15);
   out.write(t2.stage3_ticks & 15);
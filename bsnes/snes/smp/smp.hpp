@@ -5,6 +5,12 @@ public:
   alwaysinline void synchronize_cpu();
   alwaysinline void synchronize_dsp();
 
+  //when lockstep is false, the S-CPU and S-SMP only synchronize exactly on
+  //$2140-$2143 / $f4-$f7 port accesses; otherwise either side may run up to
+  //sync_window clocks ahead of the other (see Configuration::SMP::sync_window)
+  bool lockstep;
+  int64 sync_window;
+
   void enter();
   void power();
   void reset();
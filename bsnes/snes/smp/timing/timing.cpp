@@ -8,10 +8,10 @@
 //sometimes the SMP will run far slower than expected
 //other times (and more likely), the SMP will deadlock until the system is reset
 //the timers are not affected by this and advance by their expected values
-void SMP::wait(uint16 addr, bool half) {
-  static const unsigned cycleWaitStates[4] = {2, 4, 10, 20};
-  static const unsigned timerWaitStates[4] = {2, 4,  8, 16};
+static const unsigned cycleWaitStates[4] = {2, 4, 10, 20};
+static const unsigned timerWaitStates[4] = {2, 4,  8, 16};
 
+void SMP::wait(uint16 addr, bool half) {
   unsigned waitStates = status.external_speed;
   if((addr & 0xfff0) == 0x00f0) 
     waitStates = status.internal_speed;  //IO registers + idle cycles
@@ -22,31 +22,49 @@ void SMP::wait(uint16 addr, bool half) {
   step_timers(timerWaitStates[waitStates] >> half);
 }
 
+//RAM outside the I/O registers and IPL ROM (see SMP::ram_only())
+void SMP::wait_ram() {
+  add_clocks(12 * cycleWaitStates[status.external_speed]);
+  step_timers(timerWaitStates[status.external_speed]);
+}
+
 void SMP::add_clocks(unsigned clocks) {
   step(clocks);
-  synchronize_dsp();
+  if(DSP::Batched == false) synchronize_dsp();
 
   //forcefully sync S-SMP to S-CPU in case chips are not communicating
-  //sync if S-SMP is more than 24 samples ahead of S-CPU
-  if(clock > +(768 * 24 * (int64)24000000)) synchronize_cpu();
+  //sync if S-SMP is more than sync_window (default: 24 samples) ahead of S-CPU
+  if(clock > sync_window) synchronize_cpu();
 }
 
 void SMP::step_timers(unsigned clocks) {
-  t0.step(clocks);
-  t1.step(clocks);
-  t2.step(clocks);
+  timer_clocks += clocks;
+  //bound the catch-up work, and keep the count from ever overflowing
+  if(timer_clocks >= 0x10000) sync_timers();
+}
+
+//stepping the timers by the accumulated clocks at once gives the same result as
+//stepping them on every cycle: the stage 1 lines only depend on $00f0 and $00f1,
+//and stage 2 on $00fa-$00fc, and every write to those catches the timers up first
+void SMP::sync_timers() {
+  t0.step(timer_clocks);
+  t1.step(timer_clocks);
+  t2.step(timer_clocks);
+  timer_clocks = 0;
 }
 
 template<unsigned timer_frequency>
 void SMP::sSMPTimer<timer_frequency>::step(unsigned clocks) {
   //stage 0 increment
-  stage0_ticks += clocks;
-  if(stage0_ticks < timer_frequency) return;
-  stage0_ticks -= timer_frequency;
+  clocks += stage0_ticks;
+  while(clocks >= timer_frequency) {
+    clocks -= timer_frequency;
 
-  //stage 1 increment
-  stage1_ticks ^= 1;
-  sync_stage1();
+    //stage 1 increment
+    stage1_ticks ^= 1;
+    sync_stage1();
+  }
+  stage0_ticks = clocks;
 }
 
 template<unsigned frequency>
@@ -18,5 +18,11 @@ sSMPTimer<128> t1;
 sSMPTimer< 16> t2;
 
 alwaysinline void wait(uint16 addr, bool half = false);
+alwaysinline void wait_ram();
 alwaysinline void add_clocks(unsigned clocks);
 alwaysinline void step_timers(unsigned clocks);
+
+//timer clocks not yet applied to t0-t2; they are only caught up (sync_timers())
+//when the timer state can be observed or its inputs change
+unsigned timer_clocks;
+void sync_timers();
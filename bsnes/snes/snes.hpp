@@ -15,6 +15,7 @@ namespace SNES {
 
 #include <libco/libco.h>
 
+#include <chrono>
 #include <map>
 #include <vector>
 #include <nall/algorithm.hpp>
@@ -24,6 +25,7 @@ namespace SNES {
 #include <nall/dl.hpp>
 #include <nall/endian.hpp>
 #include <nall/file.hpp>
+#include <nall/filemap.hpp>
 #include <nall/foreach.hpp>
 #include <nall/function.hpp>
 #include <nall/moduloarray.hpp>
@@ -125,6 +127,8 @@ namespace SNES {
     virtual void     setFlag(unsigned id, bool value) {}
   };
 
+  struct Coprocessor;
+
   #include <memory/memory.hpp>
   #include <cpu/core/core.hpp>
   #include <smp/core/core.hpp>
@@ -41,6 +41,34 @@ bool System::unserialize(serializer &s) {
   return true;
 }
 
+//hashes only what the subset needs; the full serialize_all() pass is optional, as it is far slower
+void System::state_hash(uint32 hash[StateComponents], bool all) {
+  hash[(unsigned)StateComponent::WRAM] = crc32_calculate(memory::wram.data(), memory::wram.size());
+  hash[(unsigned)StateComponent::VRAM] = crc32_calculate(memory::vram.data(), memory::vram.size());
+  hash[(unsigned)StateComponent::APURAM] = crc32_calculate(memory::apuram.data(), memory::apuram.size());
+
+  serializer cpu_size;
+  cpu.serialize(cpu_size);
+  serializer cpu_state(cpu_size.size());
+  cpu.serialize(cpu_state);
+  hash[(unsigned)StateComponent::CPU] = crc32_calculate(cpu_state.data(), cpu_state.size());
+
+  serializer smp_size;
+  smp.serialize(smp_size);
+  serializer smp_state(smp_size.size());
+  smp.serialize(smp_state);
+  hash[(unsigned)StateComponent::SMP] = crc32_calculate(smp_state.data(), smp_state.size());
+
+  hash[(unsigned)StateComponent::All] = 0;
+  if(all) {
+    serializer state(serialize_size);
+    hashing = true;
+    serialize_all(state);
+    hashing = false;
+    hash[(unsigned)StateComponent::All] = crc32_calculate(state.data(), state.size());
+  }
+}
+
 //========
 //internal
 //========
@@ -51,6 +79,10 @@ void System::serialize(serializer &s) {
 }
 
 void System::serialize_all(serializer &s) {
+  #if defined(SCHEDULER_QUEUE)
+  scheduler.coprocessor_queue.update();
+  #endif
+
   bus.serialize(s);
   cartridge.serialize(s);
   system.serialize(s);
@@ -76,6 +108,10 @@ void System::serialize_all(serializer &s) {
   if(cartridge.has_obc1()) obc1.serialize(s);
   if(cartridge.has_msu1()) msu1.serialize(s);
   if(cartridge.has_serial()) serial.serialize(s);
+
+  #if defined(SCHEDULER_QUEUE)
+  if(s.mode() == serializer::Load) scheduler.coprocessor_queue.reset();
+  #endif
 }
 
 //called once upon cartridge load event: perform dry-run state save.
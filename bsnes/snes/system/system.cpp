@@ -1,4 +1,5 @@
 #include <snes.hpp>
+#include <nall/crc32.hpp>
 
 #define SYSTEM_CPP
 namespace SNES {
@@ -45,6 +46,9 @@ void System::runtosave() {
       if (!runthreadtosave(dsp.thread)) continue;
     }
 	bool synchronized = true;
+    #if defined(SCHEDULER_QUEUE)
+    scheduler.coprocessor_queue.update();
+    #endif
     for(unsigned i = 0; i < cpu.coprocessors.size(); i++) {
       Processor &chip = *cpu.coprocessors[i];
       synchronized &= runthreadtosave(chip.thread);
@@ -52,6 +56,9 @@ void System::runtosave() {
 	if (synchronized) break;
   }
   
+  #if defined(SCHEDULER_QUEUE)
+  scheduler.coprocessor_queue.reset();
+  #endif
   scheduler.mode = Scheduler::Mode::Run;
   scheduler.thread = cpu.thread;
 }
@@ -114,12 +121,9 @@ void System::power() {
   apu_frequency = region() == Region::NTSC ? config().smp.ntsc_frequency : config().smp.pal_frequency;
 
   bus.power();
-  memory::mmio.map(0x2100, 0x213f, ppu);
+  ppu.mmio_map();
   memory::mmio.map(0x2140, 0x217f, smp);
-  memory::mmio.map(0x2180, 0x2183, cpu);
-  memory::mmio.map(0x4016, 0x4017, cpu);
-  memory::mmio.map(0x4200, 0x421f, cpu);
-  memory::mmio.map(0x4300, 0x437f, cpu);
+  cpu.mmio_map();
 
   audio.init();
   if(expansion == ExpansionPortDevice::BSX) bsxbase.enable();
@@ -230,7 +234,11 @@ void System::unload() {
 
 void System::scanline() {
   video.scanline();
-  if(cpu.vcounter() == 241) scheduler.exit(Scheduler::ExitReason::FrameEvent);
+  if(cpu.vcounter() == 241) {
+    //complete the frame's audio; a batched S-DSP may still be behind the S-SMP
+    if(DSP::Batched) while(dsp.clock < 0) dsp.enter();
+    scheduler.exit(Scheduler::ExitReason::FrameEvent);
+  }
 }
 
 void System::frame() {
@@ -239,6 +247,7 @@ void System::frame() {
 System::System() : interface(0) {
   region = Region::Autodetect;
   expansion = ExpansionPortDevice::None;
+  hashing = false;
 }
 
 }
@@ -27,6 +27,13 @@ public:
   serializer serialize();
   bool unserialize(serializer&);
 
+  //CRC32 of each part of the emulated state, for determinism checks.
+  //unlike serialize(), threads are not first run to a save point, so emulation is left unperturbed.
+  enum class StateComponent : unsigned { WRAM, VRAM, APURAM, CPU, SMP, All };
+  enum : unsigned { StateComponents = 6 };
+  void state_hash(uint32 hash[StateComponents], bool all);
+  readonly<bool> hashing;  //true while state_hash() serializes
+
   System();
 
 private:
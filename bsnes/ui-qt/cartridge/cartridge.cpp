@@ -477,17 +477,36 @@ bool Cartridge::applyIPS(string &filename, uint8_t *&data, unsigned &size) {
 bool Cartridge::loadCartridge(string &filename, string &xml, SNES::MappedRAM &memory) {
   if(file::exists(filename) == false) return false;
 
-  uint8_t *data;
-  unsigned size;
   audio.clear();
-  if(reader.load(filename, data, size) == false) return false;
-
   patchApplied = "";
 
   string bpsName(filepath(nall::basename(filename), config().path.patch), ".bps");
   string upsName(filepath(nall::basename(filename), config().path.patch), ".ups");
   string ipsName(filepath(nall::basename(filename), config().path.patch), ".ips");
 
+  //with file.mapRom set, uncompressed, headerless and unpatched base cartridge images are mapped
+  //read-only rather than copied. this is off by default: an assembler rewriting the image would
+  //change (or truncate) ROM under the running emulator, Windows would lock the file against it,
+  //and the debugger could not edit ROM. slot cartridges are always copied (BS-X flash is rewritable)
+  bool patched = config().file.applyPatches && (file::exists(bpsName) || file::exists(upsName) || file::exists(ipsName));
+  bool mappable = config().file.mapRom && &memory == &SNES::memory::cartrom && (striend(filename, ".sfc") || striend(filename, ".smc"));
+  if(mappable && patched == false && memory.map(filename)) {
+    if((memory.size() & 0x7fff) != 512) {
+      name = string(nall::basename(filename), ".xml");
+      if(file::exists(name)) {
+        xml.readfile(name);
+      } else {
+        xml = SNESCartridge(memory.data(), memory.size()).xmlMemoryMap;
+      }
+      return true;
+    }
+    memory.reset();
+  }
+
+  uint8_t *data;
+  unsigned size;
+  if(reader.load(filename, data, size) == false) return false;
+
   if(config().file.applyPatches) {
     if(applyBPS(bpsName, data, size)) {
       patchApplied = "BPS";
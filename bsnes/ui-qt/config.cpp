@@ -24,9 +24,11 @@ Configuration::Configuration() {
   attach(snes_config.cpu.ntsc_frequency = 21477272, "cpu.ntscFrequency");
   attach(snes_config.cpu.pal_frequency  = 21281370, "cpu.palFrequency");
   attach(snes_config.cpu.wram_init_value =     0x55, "cpu.wramInitValue");
+  attach(snes_config.cpu.idle_skip      =    false, "cpu.idleSkip", "Fast-forward S-CPU idle loops and WAI (performance profile only)");
 
   attach(snes_config.smp.ntsc_frequency = 24607104, "smp.ntscFrequency");
   attach(snes_config.smp.pal_frequency  = 24607104, "smp.palFrequency");
+  attach(snes_config.smp.sync_window    =        0, "smp.syncWindow", "Samples the S-SMP may run ahead of or behind the S-CPU between port accesses; 0 = lockstep");
 
   attach(snes_config.ppu1.version = 1, "ppu1.version", "Valid version(s) are: 1");
   attach(snes_config.ppu2.version = 3, "ppu2.version", "Valid version(s) are: 1, 2, 3");
@@ -59,6 +61,7 @@ Configuration::Configuration() {
   attach(diskBrowser.showPanel = true, "diskBrowser.showPanel");
 
   attach(file.applyPatches = true, "file.applyPatches");
+  attach(file.mapRom = false, "file.mapRom", "Map unpatched cartridge images read-only rather than loading a copy; the file must not change while loaded, and the debugger cannot edit ROM");
 
   attach(path.rom   = "", "path.rom");
   attach(path.save  = "", "path.save");
@@ -16,6 +16,7 @@ public:
 
   struct File {
     bool applyPatches;
+    bool mapRom;
   } file;
 
   struct DiskBrowser {
@@ -5,6 +5,7 @@ PropertiesWidget *ppuPropertiesTab;
 PropertiesWidget *dspPropertiesTab;
 PropertiesWidget *sa1PropertiesTab;
 PropertiesWidget *sfxPropertiesTab;
+PropertiesWidget *schedulerPropertiesTab;
 PropertiesViewer *propertiesViewer;
 
 void PropertiesWidget::refresh() {
@@ -57,6 +58,7 @@ void PropertiesViewer::refresh() {
   dspPropertiesTab->refresh();
   sa1PropertiesTab->refresh();
   sfxPropertiesTab->refresh();
+  schedulerPropertiesTab->refresh();
 }
 
 void PropertiesViewer::show() {
@@ -64,6 +66,11 @@ void PropertiesViewer::show() {
   refresh();
 }
 
+void PropertiesViewer::toggleSchedulerProfiling() {
+  SNES::scheduler.profile(profileSchedulerBox->isChecked());
+  refresh();
+}
+
 void PropertiesViewer::autoUpdate() {
   if(isVisible() && autoUpdateBox->isChecked()) refresh();
 }
@@ -100,15 +107,22 @@ PropertiesViewer::PropertiesViewer() {
   sfxPropertiesTab = new PropertiesWidget(SNES::superfx);
   tabWidget->addTab(sfxPropertiesTab, "Super FX");
 
+  schedulerPropertiesTab = new PropertiesWidget(SNES::scheduler);
+  tabWidget->addTab(schedulerPropertiesTab, "Scheduler");
+
   controlLayout = new QHBoxLayout;
   controlLayout->setAlignment(Qt::AlignRight);
   layout->addLayout(controlLayout);
 
+  profileSchedulerBox = new QCheckBox("Profile scheduler");
+  controlLayout->addWidget(profileSchedulerBox);
+
   autoUpdateBox = new QCheckBox("Auto update");
   controlLayout->addWidget(autoUpdateBox);
 
   refreshButton = new QPushButton("Refresh");
   controlLayout->addWidget(refreshButton);
 
+  connect(profileSchedulerBox, SIGNAL(stateChanged(int)), this, SLOT(toggleSchedulerProfiling()));
   connect(refreshButton, SIGNAL(released()), this, SLOT(refresh()));
 }
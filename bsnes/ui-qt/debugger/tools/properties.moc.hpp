@@ -22,6 +22,7 @@ public:
   QTabWidget *tabWidget;
   QHBoxLayout *controlLayout;
   QCheckBox *autoUpdateBox;
+  QCheckBox *profileSchedulerBox;
   QPushButton *refreshButton;
 
   void autoUpdate();
@@ -30,6 +31,7 @@ public:
 public slots:
   void refresh();
   void show();
+  void toggleSchedulerProfiling();
 };
 
 extern PropertiesWidget *cpuPropertiesTab;
@@ -38,4 +40,5 @@ extern PropertiesWidget *ppuPropertiesTab;
 extern PropertiesWidget *dspPropertiesTab;
 extern PropertiesWidget *sa1PropertiesTab;
 extern PropertiesWidget *sfxPropertiesTab;
+extern PropertiesWidget *schedulerPropertiesTab;
 extern PropertiesViewer *propertiesViewer;
@@ -21,6 +21,7 @@
 #if defined(_WIN32)
   #include <io.h>
   #include <direct.h>
+  #include <process.h>
   #include <shlobj.h>
   #undef interface
   #define bsnesexport __declspec(dllexport)
@@ -52,6 +53,7 @@
 
 #if defined(_WIN32)
   #define getcwd      _getcwd
+  #define getpid      _getpid
   #define ftruncate   _chsize
   #define putenv      _putenv
   #define mkdir(n, m) _wmkdir(nall::utf16_t(n))
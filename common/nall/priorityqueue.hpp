@@ -61,6 +61,13 @@ namespace nall {
       return event;
     }
 
+    //ticks until the next event fires (eg tick(remaining() - 1) fires nothing);
+    //returns std::numeric_limits<unsigned>::max() >> 1 when the queue is empty.
+    unsigned remaining() const {
+      if(heapsize == 0) return std::numeric_limits<unsigned>::max() >> 1;
+      return heap[0].counter - basecounter;
+    }
+
     void reset() {
       basecounter = 0;
       heapsize = 0;